@@ -0,0 +1,12 @@
+/// @file main_bench.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
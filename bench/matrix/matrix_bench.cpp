@@ -0,0 +1,394 @@
+/// @file matrix_bench.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Benchmarks of the public Matrix operations, each next to the same operation in Eigen.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+/// Every benchmark takes the matrix size n from 8 to 4096. FLOP/s uses the textbook flop count of the operation, so
+/// math-cpp and Eigen rows of the same size compare directly. Vector benchmarks use vectors of n * n elements so they
+/// move as much memory as the matrix ones.
+///
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <eigen3/Eigen/Dense>
+#include <vector>
+
+#include "src/matrix/matrix.h"
+
+namespace math_cpp {
+namespace bench {
+
+using matrix::Matrix;
+
+namespace {
+constexpr int kMinSize = 8;
+constexpr int kMaxSize = 4096;
+// Matrices per batch in the batch benchmarks, which take n from 4 to 32.
+constexpr std::size_t kBatchCount = 4096;
+// Queries, embedding dimension and neighbors per query of the cosine search benchmarks.
+constexpr std::size_t kSearchQueries = 64;
+constexpr std::size_t kSearchDimension = 128;
+constexpr std::size_t kSearchTop = 10;
+
+void Sizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(2)->Range(kMinSize, kMaxSize)->Unit(benchmark::kMicrosecond);
+}
+
+/// Reports FLOP/s and bytes/s from the work of one iteration.
+void Report(benchmark::State& state, double flops, double bytes) {
+    state.counters["FLOP/s"] = benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate);
+    state.SetBytesProcessed(static_cast<int64_t>(bytes) * state.iterations());
+}
+
+void BatchSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(2)->Range(4, 32)->Unit(benchmark::kMicrosecond);
+}
+
+std::size_t Size(const benchmark::State& state) { return static_cast<std::size_t>(state.range(0)); }
+
+double Cube(std::size_t n) { return static_cast<double>(n) * static_cast<double>(n) * static_cast<double>(n); }
+
+double MatrixBytes(std::size_t n) { return static_cast<double>(n * n * sizeof(double)); }
+
+/// Scores of all queries against a corpus of 16 n rows.
+double SearchFlops(std::size_t n) {
+    return 2.0 * static_cast<double>(kSearchQueries) * 16.0 * static_cast<double>(n) * kSearchDimension;
+}
+
+Matrix MakeSymmetric(std::size_t n) {
+    Matrix A = Matrix::Random(n, n);
+    Matrix S = A + A.Transpose();
+    return S;
+}
+
+Eigen::MatrixXd MakeEigenSymmetric(std::size_t n) {
+    Eigen::MatrixXd A = Eigen::MatrixXd::Random(static_cast<Eigen::Index>(n), static_cast<Eigen::Index>(n));
+    Eigen::MatrixXd S = A + A.transpose();
+    return S;
+}
+
+/// Symmetric with a diagonal large enough to dominate, so positive definite.
+Matrix MakePositiveDefinite(std::size_t n) {
+    Matrix S = MakeSymmetric(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        S(i, i) += 2.0 * static_cast<double>(n);
+    }
+    return S;
+}
+
+Eigen::MatrixXd MakeEigenPositiveDefinite(std::size_t n) {
+    Eigen::MatrixXd S = MakeEigenSymmetric(n);
+    S.diagonal().array() += 2.0 * static_cast<double>(n);
+    return S;
+}
+}  // namespace
+
+void BM_MatrixMultiply(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    Matrix A = Matrix::Random(n, n);
+    Matrix B = Matrix::Random(n, n);
+    for (auto _ : state) {
+        Matrix C = A * B;
+        benchmark::DoNotOptimize(C.Data());
+    }
+    Report(state, 2.0 * Cube(n), 3.0 * MatrixBytes(n));
+}
+BENCHMARK(BM_MatrixMultiply)->Apply(Sizes);
+
+void BM_EigenMultiply(benchmark::State& state) {
+    const auto n = static_cast<Eigen::Index>(state.range(0));
+    Eigen::MatrixXd A = Eigen::MatrixXd::Random(n, n);
+    Eigen::MatrixXd B = Eigen::MatrixXd::Random(n, n);
+    for (auto _ : state) {
+        Eigen::MatrixXd C = A * B;
+        benchmark::DoNotOptimize(C.data());
+    }
+    Report(state, 2.0 * Cube(Size(state)), 3.0 * MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_EigenMultiply)->Apply(Sizes);
+
+void BM_MatrixInverse(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    Matrix A = Matrix::Random(n, n);
+    for (auto _ : state) {
+        Matrix inverse = A.Inverse();
+        benchmark::DoNotOptimize(inverse.Data());
+    }
+    Report(state, 2.0 * Cube(n), 2.0 * MatrixBytes(n));
+}
+BENCHMARK(BM_MatrixInverse)->Apply(Sizes);
+
+void BM_EigenInverse(benchmark::State& state) {
+    const auto n = static_cast<Eigen::Index>(state.range(0));
+    Eigen::MatrixXd A = Eigen::MatrixXd::Random(n, n);
+    for (auto _ : state) {
+        Eigen::MatrixXd inverse = A.inverse();
+        benchmark::DoNotOptimize(inverse.data());
+    }
+    Report(state, 2.0 * Cube(Size(state)), 2.0 * MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_EigenInverse)->Apply(Sizes);
+
+void BM_MatrixDeterminant(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    Matrix A = Matrix::Random(n, n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Matrix::Determinant(A));
+    }
+    Report(state, 2.0 / 3.0 * Cube(n), MatrixBytes(n));
+}
+BENCHMARK(BM_MatrixDeterminant)->Apply(Sizes);
+
+void BM_EigenDeterminant(benchmark::State& state) {
+    const auto n = static_cast<Eigen::Index>(state.range(0));
+    Eigen::MatrixXd A = Eigen::MatrixXd::Random(n, n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(A.determinant());
+    }
+    Report(state, 2.0 / 3.0 * Cube(Size(state)), MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_EigenDeterminant)->Apply(Sizes);
+
+void BM_MatrixCholesky(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    Matrix A = MakePositiveDefinite(n);
+    for (auto _ : state) {
+        matrix::CholeskySolver solver(A);
+        benchmark::DoNotOptimize(solver.IsPositiveDefinite());
+    }
+    Report(state, 1.0 / 3.0 * Cube(n), MatrixBytes(n));
+}
+BENCHMARK(BM_MatrixCholesky)->Apply(Sizes);
+
+void BM_EigenCholesky(benchmark::State& state) {
+    Eigen::MatrixXd A = MakeEigenPositiveDefinite(Size(state));
+    for (auto _ : state) {
+        Eigen::LLT<Eigen::MatrixXd> llt(A);
+        benchmark::DoNotOptimize(llt.info());
+    }
+    Report(state, 1.0 / 3.0 * Cube(Size(state)), MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_EigenCholesky)->Apply(Sizes);
+
+void BM_MatrixQR(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    Matrix A = Matrix::Random(n, n);
+    for (auto _ : state) {
+        matrix::QRSolver solver(A);
+        benchmark::DoNotOptimize(solver.Permutation().data());
+    }
+    Report(state, 4.0 / 3.0 * Cube(n), MatrixBytes(n));
+}
+BENCHMARK(BM_MatrixQR)->Apply(Sizes);
+
+void BM_EigenQR(benchmark::State& state) {
+    const auto n = static_cast<Eigen::Index>(state.range(0));
+    Eigen::MatrixXd A = Eigen::MatrixXd::Random(n, n);
+    for (auto _ : state) {
+        Eigen::HouseholderQR<Eigen::MatrixXd> qr(A);
+        benchmark::DoNotOptimize(qr.matrixQR().data());
+    }
+    Report(state, 4.0 / 3.0 * Cube(Size(state)), MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_EigenQR)->Apply(Sizes);
+
+/// Singular values and both sets of vectors. About 8 / 3 n^3 flops for the bidiagonalization, 8 / 3 n^3 to form U and
+/// V, and roughly 12 n^3 for the rotations of the QR iteration, 22 n^3 in total as in Golub and Van Loan.
+void BM_MatrixSVD(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    Matrix A = Matrix::Random(n, n);
+    for (auto _ : state) {
+        matrix::SVDSolver svd(A);
+        benchmark::DoNotOptimize(svd.VTranspose().Data());
+    }
+    Report(state, 22.0 * Cube(n), MatrixBytes(n));
+}
+BENCHMARK(BM_MatrixSVD)->Apply(Sizes);
+
+void BM_EigenSVD(benchmark::State& state) {
+    const auto n = static_cast<Eigen::Index>(state.range(0));
+    Eigen::MatrixXd A = Eigen::MatrixXd::Random(n, n);
+    for (auto _ : state) {
+        Eigen::BDCSVD<Eigen::MatrixXd> svd(A, Eigen::ComputeThinU | Eigen::ComputeThinV);
+        benchmark::DoNotOptimize(svd.matrixV().data());
+    }
+    Report(state, 22.0 * Cube(Size(state)), MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_EigenSVD)->Apply(Sizes);
+
+/// Rank 20 (or n) with the default oversampling of 10 and 2 power iterations: six products of A or A^T with up to 30
+/// columns. Eigen has no randomized SVD to compare with.
+void BM_MatrixRandomizedSVD(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    const std::size_t rank = std::min<std::size_t>(20, n);
+    Matrix A = Matrix::Random(n, n);
+    for (auto _ : state) {
+        matrix::RandomizedSVD svd(A, rank);
+        benchmark::DoNotOptimize(svd.U().Data());
+    }
+    const double columns = static_cast<double>(std::min<std::size_t>(rank + 10, n));
+    Report(state, 6.0 * 2.0 * columns * static_cast<double>(n) * static_cast<double>(n), MatrixBytes(n));
+}
+BENCHMARK(BM_MatrixRandomizedSVD)->Apply(Sizes);
+
+/// Top kSearchTop of kSearchQueries queries in a corpus of 16 n embeddings. Eigen has no search, it is written out
+/// below as normalize, one product and a partial sort per query.
+void BM_MatrixCosineSearch(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    matrix::CosineIndex index(Matrix::Random(16 * n, kSearchDimension));
+    Matrix queries = Matrix::Random(kSearchQueries, kSearchDimension);
+    for (auto _ : state) {
+        matrix::CosineIndex::Neighbors neighbors = index.Search(queries, kSearchTop);
+        benchmark::DoNotOptimize(neighbors.indices.data());
+    }
+    Report(state, SearchFlops(n), 16.0 * static_cast<double>(n) * kSearchDimension * sizeof(double));
+}
+BENCHMARK(BM_MatrixCosineSearch)->Apply(Sizes);
+
+void BM_EigenCosineSearch(benchmark::State& state) {
+    const auto rows = static_cast<Eigen::Index>(16 * Size(state));
+    Eigen::MatrixXd corpus = Eigen::MatrixXd::Random(rows, kSearchDimension).rowwise().normalized();
+    Eigen::MatrixXd queries = Eigen::MatrixXd::Random(kSearchQueries, kSearchDimension);
+    std::vector<Eigen::Index> order(static_cast<std::size_t>(rows));
+    for (auto _ : state) {
+        Eigen::MatrixXd scores = queries.rowwise().normalized() * corpus.transpose();
+        for (Eigen::Index i = 0; i < scores.rows(); ++i) {
+            for (std::size_t j = 0; j < order.size(); ++j) {
+                order[j] = static_cast<Eigen::Index>(j);
+            }
+            std::partial_sort(
+                std::begin(order), std::begin(order) + kSearchTop, std::end(order),
+                [&scores, i](Eigen::Index lhs, Eigen::Index rhs) { return scores(i, lhs) > scores(i, rhs); });
+            benchmark::DoNotOptimize(order.data());
+        }
+    }
+    Report(state, SearchFlops(Size(state)), static_cast<double>(rows) * kSearchDimension * sizeof(double));
+}
+BENCHMARK(BM_EigenCosineSearch)->Apply(Sizes);
+
+void BM_MatrixTranspose(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    Matrix A = Matrix::Random(n, n);
+    for (auto _ : state) {
+        Matrix transposed = A.Transpose();
+        benchmark::DoNotOptimize(transposed.Data());
+    }
+    Report(state, 0.0, 2.0 * MatrixBytes(n));
+}
+BENCHMARK(BM_MatrixTranspose)->Apply(Sizes);
+
+void BM_EigenTranspose(benchmark::State& state) {
+    const auto n = static_cast<Eigen::Index>(state.range(0));
+    Eigen::MatrixXd A = Eigen::MatrixXd::Random(n, n);
+    for (auto _ : state) {
+        Eigen::MatrixXd transposed = A.transpose();
+        benchmark::DoNotOptimize(transposed.data());
+    }
+    Report(state, 0.0, 2.0 * MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_EigenTranspose)->Apply(Sizes);
+
+/// Symmetric input, eigenvalues and eigenvectors. About 9 n^3 flops for tridiagonalization plus QL with vectors.
+void BM_MatrixEigenSolver(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    Matrix A = MakeSymmetric(n);
+    for (auto _ : state) {
+        matrix::EigenSolver solver(A);
+        benchmark::DoNotOptimize(solver.Eigenvalues().Data());
+    }
+    Report(state, 9.0 * Cube(n), 2.0 * MatrixBytes(n));
+}
+BENCHMARK(BM_MatrixEigenSolver)->Apply(Sizes);
+
+void BM_EigenEigenSolver(benchmark::State& state) {
+    Eigen::MatrixXd A = MakeEigenSymmetric(Size(state));
+    for (auto _ : state) {
+        Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(A);
+        benchmark::DoNotOptimize(solver.eigenvalues().data());
+    }
+    Report(state, 9.0 * Cube(Size(state)), 2.0 * MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_EigenEigenSolver)->Apply(Sizes);
+
+void BM_MatrixCosineSimilarity(benchmark::State& state) {
+    const std::size_t length = Size(state) * Size(state);
+    Matrix lhs = Matrix::Random(length, 1);
+    Matrix rhs = Matrix::Random(1, length);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix::Util::CosineSimilarity(lhs, rhs));
+    }
+    Report(state, 6.0 * static_cast<double>(length), 2.0 * MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_MatrixCosineSimilarity)->Apply(Sizes);
+
+void BM_EigenCosineSimilarity(benchmark::State& state) {
+    const auto length = static_cast<Eigen::Index>(Size(state) * Size(state));
+    Eigen::VectorXd lhs = Eigen::VectorXd::Random(length);
+    Eigen::VectorXd rhs = Eigen::VectorXd::Random(length);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs.dot(rhs) / (lhs.norm() * rhs.norm()));
+    }
+    Report(state, 6.0 * static_cast<double>(length), 2.0 * MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_EigenCosineSimilarity)->Apply(Sizes);
+
+void BM_MatrixRandom(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    for (auto _ : state) {
+        Matrix A = Matrix::Random(n, n);
+        benchmark::DoNotOptimize(A.Data());
+    }
+    Report(state, 0.0, MatrixBytes(n));
+}
+BENCHMARK(BM_MatrixRandom)->Apply(Sizes);
+
+/// Eigen draws uniform numbers, math-cpp draws gaussian ones, so this is only a lower bound.
+void BM_EigenRandom(benchmark::State& state) {
+    const auto n = static_cast<Eigen::Index>(state.range(0));
+    for (auto _ : state) {
+        Eigen::MatrixXd A = Eigen::MatrixXd::Random(n, n);
+        benchmark::DoNotOptimize(A.data());
+    }
+    Report(state, 0.0, MatrixBytes(Size(state)));
+}
+BENCHMARK(BM_EigenRandom)->Apply(Sizes);
+
+/// kBatchCount small n x n inverses, batched against one Inverse call per matrix.
+void BM_MatrixBatchInverse(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    matrix::MatrixBatch A(kBatchCount, n, n);
+    for (std::size_t i = 0; i < kBatchCount; ++i) {
+        A.Set(i, Matrix::Random(n, n));
+    }
+    matrix::MatrixBatch result{};
+    for (auto _ : state) {
+        matrix::BatchInverse(A, result);
+        benchmark::DoNotOptimize(result.ElementData(0, 0));
+    }
+    Report(state, 2.0 * Cube(n) * kBatchCount, 2.0 * MatrixBytes(n) * kBatchCount);
+}
+BENCHMARK(BM_MatrixBatchInverse)->Apply(BatchSizes);
+
+void BM_MatrixLoopInverse(benchmark::State& state) {
+    const std::size_t n = Size(state);
+    std::vector<Matrix> A{};
+    for (std::size_t i = 0; i < kBatchCount; ++i) {
+        A.push_back(Matrix::Random(n, n));
+    }
+    for (auto _ : state) {
+        for (const Matrix& mat : A) {
+            Matrix inverse = mat.Inverse();
+            benchmark::DoNotOptimize(inverse.Data());
+        }
+    }
+    Report(state, 2.0 * Cube(n) * kBatchCount, 2.0 * MatrixBytes(n) * kBatchCount);
+}
+BENCHMARK(BM_MatrixLoopInverse)->Apply(BatchSizes);
+
+}  // namespace bench
+}  // namespace math_cpp
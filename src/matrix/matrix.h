@@ -11,9 +11,27 @@
 #ifndef SRC_MATRIX_MATRIX_H_
 #define SRC_MATRIX_MATRIX_H_
 
+#include "src/matrix/matrix_batch.h"
+#include "src/matrix/matrix_cholesky_solver.h"
 #include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_cosine_index.h"
+#include "src/matrix/matrix_fixed.h"
+#include "src/matrix/matrix_gemm.h"
+#include "src/matrix/matrix_kernel.h"
+#include "src/matrix/matrix_krylov_solver.h"
+#include "src/matrix/matrix_lanczos_solver.h"
+#include "src/matrix/matrix_linear_operator.h"
+#include "src/matrix/matrix_lu_solver.h"
 #include "src/matrix/matrix_operation.h"
+#include "src/matrix/matrix_qr_solver.h"
+#include "src/matrix/matrix_preconditioner.h"
+#include "src/matrix/matrix_randomized_svd.h"
+#include "src/matrix/matrix_simd.h"
+#include "src/matrix/matrix_sparse.h"
 #include "src/matrix/matrix_solver.h"
+#include "src/matrix/matrix_svd_solver.h"
+#include "src/matrix/matrix_symmetric_solver.h"
 #include "src/matrix/matrix_util.h"
+#include "src/matrix/matrix_view.h"
 
 #endif  // SRC_MATRIX_MATRIX_H_
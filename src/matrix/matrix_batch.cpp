@@ -0,0 +1,246 @@
+/// @file matrix_batch.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_batch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "src/memory/allocator.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+
+namespace {
+// Matrices eliminated together. Their working copies stay in cache and every inner loop runs over this many lanes.
+constexpr std::size_t kLanes = 32;
+
+/// Gauss-Jordan elimination of lanes [first, last). a and x are n x n and n x m in tile layout, element (r, c) of
+/// lane t at (r * cols + c) * kLanes + t. a is reduced to the identity and x becomes a^-1 * x.
+void EliminateTile(std::size_t lanes, std::size_t n, std::size_t m, double* a, double* x) {
+    auto a_at = [=](std::size_t r, std::size_t c) { return a + (r * n + c) * kLanes; };
+    auto x_at = [=](std::size_t r, std::size_t c) { return x + (r * m + c) * kLanes; };
+    double factor[kLanes];
+
+    for (std::size_t j = 0; j < n; ++j) {
+        // Pivots differ per lane, rows are swapped lane by lane.
+        for (std::size_t t = 0; t < lanes; ++t) {
+            std::size_t pivot = j;
+            for (std::size_t i = j + 1; i < n; ++i) {
+                if (std::abs(a_at(i, j)[t]) > std::abs(a_at(pivot, j)[t])) {
+                    pivot = i;
+                }
+            }
+            if (a_at(pivot, j)[t] == 0.0) {
+                throw std::invalid_argument("matrix is singular");
+            }
+            if (pivot != j) {
+                for (std::size_t c = j; c < n; ++c) {
+                    std::swap(a_at(j, c)[t], a_at(pivot, c)[t]);
+                }
+                for (std::size_t c = 0; c < m; ++c) {
+                    std::swap(x_at(j, c)[t], x_at(pivot, c)[t]);
+                }
+            }
+        }
+
+        for (std::size_t t = 0; t < lanes; ++t) {
+            factor[t] = 1.0 / a_at(j, j)[t];
+        }
+        for (std::size_t c = j; c < n; ++c) {
+            double* row = a_at(j, c);
+            for (std::size_t t = 0; t < lanes; ++t) {
+                row[t] *= factor[t];
+            }
+        }
+        for (std::size_t c = 0; c < m; ++c) {
+            double* row = x_at(j, c);
+            for (std::size_t t = 0; t < lanes; ++t) {
+                row[t] *= factor[t];
+            }
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (i == j) {
+                continue;
+            }
+            for (std::size_t t = 0; t < lanes; ++t) {
+                factor[t] = a_at(i, j)[t];
+            }
+            for (std::size_t c = j; c < n; ++c) {
+                double* dst = a_at(i, c);
+                const double* src = a_at(j, c);
+                for (std::size_t t = 0; t < lanes; ++t) {
+                    dst[t] -= factor[t] * src[t];
+                }
+            }
+            for (std::size_t c = 0; c < m; ++c) {
+                double* dst = x_at(i, c);
+                const double* src = x_at(j, c);
+                for (std::size_t t = 0; t < lanes; ++t) {
+                    dst[t] -= factor[t] * src[t];
+                }
+            }
+        }
+    }
+}
+
+/// Copies lanes [first, first + lanes) of every element between the batch layout and the tile layout.
+void GatherTile(const MatrixBatch& batch, std::size_t first, std::size_t lanes, double* tile) {
+    for (std::size_t r = 0; r < batch.Row(); ++r) {
+        for (std::size_t c = 0; c < batch.Col(); ++c) {
+            const double* src = batch.ElementData(r, c) + first;
+            std::copy(src, src + lanes, tile + (r * batch.Col() + c) * kLanes);
+        }
+    }
+}
+
+void ScatterTile(const double* tile, std::size_t first, std::size_t lanes, MatrixBatch& batch) {
+    for (std::size_t r = 0; r < batch.Row(); ++r) {
+        for (std::size_t c = 0; c < batch.Col(); ++c) {
+            const double* src = tile + (r * batch.Col() + c) * kLanes;
+            std::copy(src, src + lanes, batch.ElementData(r, c) + first);
+        }
+    }
+}
+
+/// x = a^-1 * b for every matrix, x = a^-1 when b is null.
+void GaussJordan(const MatrixBatch& a, const MatrixBatch* b, MatrixBatch& x) {
+    const std::size_t n = a.Row();
+    const std::size_t m = x.Col();
+    const std::size_t work = n * n * (n + m);
+    parallel::ParallelFor(0, a.Count(), work, [&](std::size_t first, std::size_t last) {
+        memory::Vector<double> a_tile(n * n * kLanes);
+        memory::Vector<double> x_tile(n * m * kLanes, 0.0);
+        for (std::size_t start = first; start < last; start += kLanes) {
+            const std::size_t lanes = std::min(kLanes, last - start);
+            GatherTile(a, start, lanes, a_tile.data());
+            if (b != nullptr) {
+                GatherTile(*b, start, lanes, x_tile.data());
+            } else {
+                std::fill(x_tile.begin(), x_tile.end(), 0.0);
+                for (std::size_t i = 0; i < n; ++i) {
+                    std::fill_n(x_tile.data() + (i * m + i) * kLanes, kLanes, 1.0);
+                }
+            }
+            EliminateTile(lanes, n, m, a_tile.data(), x_tile.data());
+            ScatterTile(x_tile.data(), start, lanes, x);
+        }
+    });
+}
+}  // namespace
+
+MatrixBatch::MatrixBatch(std::size_t count, std::size_t row, std::size_t col)
+    : data_(count * row * col, 0.0), count_(count), row_(row), col_(col) {}
+
+std::size_t MatrixBatch::Count() const { return count_; }
+std::size_t MatrixBatch::Row() const { return row_; }
+std::size_t MatrixBatch::Col() const { return col_; }
+
+double& MatrixBatch::operator()(std::size_t index, std::size_t row, std::size_t col) {
+    return data_[(row * col_ + col) * count_ + index];
+}
+
+double MatrixBatch::operator()(std::size_t index, std::size_t row, std::size_t col) const {
+    return data_[(row * col_ + col) * count_ + index];
+}
+
+double* MatrixBatch::ElementData(std::size_t row, std::size_t col) {
+    return data_.Data() + (row * col_ + col) * count_;
+}
+
+const double* MatrixBatch::ElementData(std::size_t row, std::size_t col) const {
+    return data_.Data() + (row * col_ + col) * count_;
+}
+
+Matrix MatrixBatch::Get(std::size_t index) const {
+    if (index >= count_) {
+        throw std::invalid_argument("check batch index");
+    }
+    Matrix result(row_, col_);
+    for (std::size_t r = 0; r < row_; ++r) {
+        for (std::size_t c = 0; c < col_; ++c) {
+            result.AtUnchecked(r, c) = (*this)(index, r, c);
+        }
+    }
+    return result;
+}
+
+void MatrixBatch::Set(std::size_t index, const Matrix& mat) {
+    if (index >= count_) {
+        throw std::invalid_argument("check batch index");
+    }
+    if ((mat.Row() != row_) || (mat.Col() != col_)) {
+        throw std::invalid_argument("matrix should have the shape of the batch");
+    }
+    for (std::size_t r = 0; r < row_; ++r) {
+        for (std::size_t c = 0; c < col_; ++c) {
+            (*this)(index, r, c) = mat.AtUnchecked(r, c);
+        }
+    }
+}
+
+bool MatrixBatch::IsSameShape(const MatrixBatch& other) const {
+    return (count_ == other.count_) && (row_ == other.row_) && (col_ == other.col_);
+}
+
+void BatchGemm(double alpha, const MatrixBatch& a, const MatrixBatch& b, double beta, MatrixBatch& c) {
+    if ((a.Count() != b.Count()) || (a.Count() != c.Count()) || (a.Col() != b.Row()) || (a.Row() != c.Row()) ||
+        (b.Col() != c.Col())) {
+        throw std::invalid_argument("cannot batch multiply, check size!");
+    }
+    const std::size_t depth = a.Col();
+    parallel::ParallelFor(0, a.Count(), c.Row() * c.Col() * depth * 2, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = 0; i < c.Row(); ++i) {
+            for (std::size_t j = 0; j < c.Col(); ++j) {
+                double* dst = c.ElementData(i, j);
+                for (std::size_t t = first; t < last; ++t) {
+                    dst[t] = (beta == 0.0) ? 0.0 : beta * dst[t];
+                }
+                for (std::size_t k = 0; k < depth; ++k) {
+                    const double* lhs = a.ElementData(i, k);
+                    const double* rhs = b.ElementData(k, j);
+                    for (std::size_t t = first; t < last; ++t) {
+                        dst[t] += alpha * lhs[t] * rhs[t];
+                    }
+                }
+            }
+        }
+    });
+}
+
+void BatchInverse(const MatrixBatch& a, MatrixBatch& result) {
+    if (a.Row() != a.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+    if (!result.IsSameShape(a)) {
+        result = MatrixBatch(a.Count(), a.Row(), a.Col());
+    }
+    GaussJordan(a, nullptr, result);
+}
+
+void BatchSolve(const MatrixBatch& a, const MatrixBatch& b, MatrixBatch& x) {
+    if (a.Row() != a.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+    if ((a.Count() != b.Count()) || (a.Row() != b.Row())) {
+        throw std::invalid_argument("check size, rhs should have as many rows as the matrix");
+    }
+    if (!x.IsSameShape(b)) {
+        x = MatrixBatch(b.Count(), b.Row(), b.Col());
+    }
+    GaussJordan(a, &b, x);
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,67 @@
+/// @file matrix_batch.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Many independent small matrices of one shape, and operations over all of them at once.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_BATCH_H_
+#define SRC_MATRIX_MATRIX_BATCH_H_
+
+#include <cstddef>
+
+#include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_storage.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Count() matrices of Row() x Col() in structure-of-arrays layout. Element (r, c) of every matrix is stored
+/// contiguously, matrix index fastest, so the batch operations below run the same arithmetic on neighbouring
+/// matrices with SIMD instructions instead of looping over one small matrix at a time.
+class MatrixBatch {
+ public:
+    MatrixBatch() = default;
+    explicit MatrixBatch(std::size_t count, std::size_t row, std::size_t col);
+
+    std::size_t Count() const;
+    std::size_t Row() const;
+    std::size_t Col() const;
+
+    /// @brief Element (row, col) of matrix index, unchecked.
+    double& operator()(std::size_t index, std::size_t row, std::size_t col);
+    double operator()(std::size_t index, std::size_t row, std::size_t col) const;
+
+    /// @brief Count() contiguous values of element (row, col), unchecked.
+    double* ElementData(std::size_t row, std::size_t col);
+    const double* ElementData(std::size_t row, std::size_t col) const;
+
+    Matrix Get(std::size_t index) const;
+    void Set(std::size_t index, const Matrix& mat);
+
+    bool IsSameShape(const MatrixBatch& other) const;
+
+ private:
+    Storage data_{};
+    std::size_t count_{};
+    std::size_t row_{};
+    std::size_t col_{};
+};
+
+/// @brief c[i] = alpha * a[i] * b[i] + beta * c[i] for every i. When beta is 0, c is not read.
+void BatchGemm(double alpha, const MatrixBatch& a, const MatrixBatch& b, double beta, MatrixBatch& c);
+
+/// @brief result[i] = a[i]^-1 by Gauss-Jordan elimination with partial pivoting. result is resized when its shape
+/// differs. Throws if any matrix is singular.
+void BatchInverse(const MatrixBatch& a, MatrixBatch& result);
+
+/// @brief Solves a[i] * x[i] = b[i] for every i. b holds one or more right hand side columns. x is resized when its
+/// shape differs. Throws if any matrix is singular.
+void BatchSolve(const MatrixBatch& a, const MatrixBatch& b, MatrixBatch& x);
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_BATCH_H_
@@ -0,0 +1,400 @@
+/// @file matrix_cholesky_solver.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_cholesky_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "src/matrix/matrix_kernel.h"
+#include "src/matrix/matrix_simd.h"
+#include "src/memory/allocator.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+
+namespace {
+// Columns per panel, also the tile size of the trailing update.
+constexpr std::size_t kBlock = 64;
+
+/// A22 -= left * l21^T on the tiles of the lower triangle of A22 = a[end.., end..], in parallel. The diagonal tiles
+/// are updated whole, their upper part is never read again.
+void UpdateTrailing(Matrix& a, std::size_t end, const ConstMatrixView& left, const ConstMatrixView& l21) {
+    const std::size_t rows = a.Row() - end;
+    const std::size_t width = left.Col();
+    const std::size_t tiles = (rows + kBlock - 1) / kBlock;
+    std::vector<std::pair<std::size_t, std::size_t>> lower_tiles;
+    lower_tiles.reserve(tiles * (tiles + 1) / 2);
+    for (std::size_t ti = 0; ti < tiles; ++ti) {
+        for (std::size_t tj = 0; tj <= ti; ++tj) {
+            lower_tiles.emplace_back(ti * kBlock, tj * kBlock);
+        }
+    }
+
+    parallel::ParallelFor(0, lower_tiles.size(), 2 * kBlock * kBlock * width, [&](std::size_t first, std::size_t last) {
+        for (std::size_t t = first; t < last; ++t) {
+            const std::size_t r = lower_tiles[t].first;
+            const std::size_t c = lower_tiles[t].second;
+            const std::size_t height = std::min(kBlock, rows - r);
+            const std::size_t tile_width = std::min(kBlock, rows - c);
+            kernel::Gemm(-1.0, left.Block(r, 0, height, width), l21.Block(c, 0, tile_width, width).Transpose(), 1.0,
+                         a.Block(end + r, end + c, height, tile_width));
+        }
+    });
+}
+
+/// Solves L * X = B in place. Within a block row by row, below it one GEMM for all right hand sides.
+void ForwardSubstitution(const Matrix& l, const MatrixView& rhs, bool unit) {
+    const std::size_t n = l.Row();
+    const std::size_t m = rhs.Col();
+    for (std::size_t start = 0; start < n; start += kBlock) {
+        const std::size_t end = std::min(start + kBlock, n);
+        for (std::size_t i = start; i < end; ++i) {
+            for (std::size_t k = start; k < i; ++k) {
+                kernel::Axpy(-l.AtUnchecked(i, k), rhs.RowView(k), rhs.RowView(i));
+            }
+            if (!unit) {
+                kernel::Scale(1.0 / l.AtUnchecked(i, i), rhs.RowView(i));
+            }
+        }
+        if (end < n) {
+            kernel::Gemm(-1.0, l.Block(end, start, n - end, end - start), rhs.Block(start, 0, end - start, m), 1.0,
+                         rhs.Block(end, 0, n - end, m));
+        }
+    }
+}
+
+/// Solves L^T * X = B in place, the same blocks from the bottom on the transposed view of L.
+void BackwardSubstitution(const Matrix& l, const MatrixView& rhs, bool unit) {
+    const std::size_t n = l.Row();
+    const std::size_t m = rhs.Col();
+    for (std::size_t end = n; end > 0;) {
+        const std::size_t start = ((end - 1) / kBlock) * kBlock;
+        for (std::size_t i = end; i-- > start;) {
+            for (std::size_t k = i + 1; k < end; ++k) {
+                kernel::Axpy(-l.AtUnchecked(k, i), rhs.RowView(k), rhs.RowView(i));
+            }
+            if (!unit) {
+                kernel::Scale(1.0 / l.AtUnchecked(i, i), rhs.RowView(i));
+            }
+        }
+        if (start > 0) {
+            kernel::Gemm(-1.0, l.Block(start, 0, end - start, start).Transpose(), rhs.Block(start, 0, end - start, m),
+                         1.0, rhs.Block(0, 0, start, m));
+        }
+        end = start;
+    }
+}
+
+/// Zeros the strict upper triangle, which still holds the input.
+void ClearUpper(Matrix& l) {
+    for (std::size_t r = 0; r < l.Row(); ++r) {
+        std::fill(l.Data() + r * l.Col() + r + 1, l.Data() + (r + 1) * l.Col(), 0.0);
+    }
+}
+}  // namespace
+
+CholeskySolver::CholeskySolver(const Matrix& mat) : l_(mat) {
+    if (mat.Row() != mat.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+    Factorize();
+    ClearUpper(l_);
+}
+
+bool CholeskySolver::IsPositiveDefinite() const { return positive_definite_; }
+
+void CholeskySolver::Factorize() {
+    const std::size_t n = l_.Row();
+    double* data = l_.Data();
+    for (std::size_t start = 0; start < n; start += kBlock) {
+        const std::size_t end = std::min(start + kBlock, n);
+        const std::size_t width = end - start;
+
+        // L11, the block already carries the updates of the panels left of it.
+        for (std::size_t j = start; j < end; ++j) {
+            double* row_j = data + j * n;
+            const double pivot = row_j[j] - simd::SumSquares(row_j + start, j - start);
+            if (!(pivot > 0.0)) {
+                positive_definite_ = false;
+                return;
+            }
+            row_j[j] = std::sqrt(pivot);
+            for (std::size_t i = j + 1; i < end; ++i) {
+                double* row_i = data + i * n;
+                row_i[j] = (row_i[j] - simd::Dot(row_i + start, row_j + start, j - start)) / row_j[j];
+            }
+        }
+        if (end == n) {
+            break;
+        }
+
+        // L21 = A21 * L11^-T, every row is an independent triangular solve.
+        parallel::ParallelFor(end, n, width * width, [=](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                double* row_i = data + i * n;
+                for (std::size_t j = start; j < end; ++j) {
+                    const double* row_j = data + j * n;
+                    row_i[j] = (row_i[j] - simd::Dot(row_i + start, row_j + start, j - start)) / row_j[j];
+                }
+            }
+        });
+
+        // A22 -= L21 * L21^T
+        const ConstMatrixView l21 = l_.Block(end, start, n - end, width);
+        UpdateTrailing(l_, end, l21, l21);
+    }
+}
+
+void CholeskySolver::CheckPositiveDefinite() const {
+    if (!positive_definite_) {
+        throw std::invalid_argument("matrix is not positive definite");
+    }
+}
+
+void CholeskySolver::CheckVector(const Matrix& x) const {
+    if ((x.Row() != l_.Row()) || (x.Col() != 1)) {
+        throw std::invalid_argument("check size, x should be n x 1");
+    }
+}
+
+Matrix CholeskySolver::Solve(const Matrix& rhs) const {
+    Matrix result = rhs;
+    SolveInPlace(result);
+    return result;
+}
+
+void CholeskySolver::SolveInPlace(const MatrixView& rhs) const {
+    CheckPositiveDefinite();
+    if (rhs.Row() != l_.Row()) {
+        throw std::invalid_argument("check size, rhs should have as many rows as the matrix");
+    }
+    ForwardSubstitution(l_, rhs, false);
+    BackwardSubstitution(l_, rhs, false);
+}
+
+Matrix CholeskySolver::Inverse() const {
+    Matrix result = Matrix::Identity(l_.Row());
+    SolveInPlace(result);
+    return result;
+}
+
+double CholeskySolver::Determinant() const {
+    CheckPositiveDefinite();
+    double det = 1.0;
+    for (std::size_t i = 0; i < l_.Row(); ++i) {
+        det *= l_.AtUnchecked(i, i) * l_.AtUnchecked(i, i);
+    }
+    return det;
+}
+
+std::pair<double, double> CholeskySolver::LogDeterminant() const {
+    CheckPositiveDefinite();
+    double log_det = 0.0;
+    for (std::size_t i = 0; i < l_.Row(); ++i) {
+        log_det += 2.0 * std::log(l_.AtUnchecked(i, i));
+    }
+    return std::make_pair(1.0, log_det);
+}
+
+Matrix CholeskySolver::Lower() const {
+    CheckPositiveDefinite();
+    return l_;
+}
+
+void CholeskySolver::Update(const Matrix& x) {
+    CheckPositiveDefinite();
+    CheckVector(x);
+
+    // Row-oriented form of the Givens update, so L is walked contiguously. Rotation k is fixed when row k reaches its
+    // diagonal and is then applied to every row below.
+    const std::size_t n = l_.Row();
+    memory::Vector<double> cosines(n);
+    memory::Vector<double> sines(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        double* row = l_.Data() + i * n;
+        double w = x.AtUnchecked(i, 0);
+        for (std::size_t k = 0; k < i; ++k) {
+            row[k] = (row[k] + sines[k] * w) / cosines[k];
+            w = cosines[k] * w - sines[k] * row[k];
+        }
+        const double radius = std::hypot(row[i], w);
+        cosines[i] = radius / row[i];
+        sines[i] = w / row[i];
+        row[i] = radius;
+    }
+}
+
+void CholeskySolver::Downdate(const Matrix& x) {
+    CheckPositiveDefinite();
+    CheckVector(x);
+
+    // A - x * x^T is positive definite exactly when |L^-1 * x| < 1, checked before L is touched.
+    Matrix p = x;
+    ForwardSubstitution(l_, p, false);
+    if (!(kernel::Dot(p, p) < 1.0)) {
+        throw std::invalid_argument("downdated matrix is not positive definite");
+    }
+
+    // The new rows go to a copy, which replaces the factor only once every pivot has passed.
+    const std::size_t n = l_.Row();
+    Matrix lower = l_;
+    memory::Vector<double> cosines(n);
+    memory::Vector<double> sines(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        double* row = lower.Data() + i * n;
+        double w = x.AtUnchecked(i, 0);
+        for (std::size_t k = 0; k < i; ++k) {
+            row[k] = (row[k] - sines[k] * w) / cosines[k];
+            w = cosines[k] * w - sines[k] * row[k];
+        }
+        const double pivot = (row[i] - w) * (row[i] + w);
+        if (!(pivot > 0.0)) {
+            // Only reachable through rounding when |L^-1 * x| is within an ulp of 1.
+            throw std::invalid_argument("downdated matrix is not positive definite");
+        }
+        const double radius = std::sqrt(pivot);
+        cosines[i] = radius / row[i];
+        sines[i] = w / row[i];
+        row[i] = radius;
+    }
+    std::swap(l_, lower);
+}
+
+LDLTSolver::LDLTSolver(const Matrix& mat) : l_(mat), d_(mat.Row(), 1) {
+    if (mat.Row() != mat.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+    Factorize();
+    ClearUpper(l_);
+}
+
+bool LDLTSolver::IsSingular() const { return singular_; }
+
+void LDLTSolver::Factorize() {
+    const std::size_t n = l_.Row();
+    double* data = l_.Data();
+    double* d = d_.Data();
+    // Sum of a[k] * d[k] * b[k] over [first, last).
+    auto weighted_dot = [d](const double* a, const double* b, std::size_t first, std::size_t last) {
+        double sum = 0.0;
+        for (std::size_t k = first; k < last; ++k) {
+            sum += a[k] * d[k] * b[k];
+        }
+        return sum;
+    };
+
+    for (std::size_t start = 0; start < n; start += kBlock) {
+        const std::size_t end = std::min(start + kBlock, n);
+        const std::size_t width = end - start;
+
+        for (std::size_t j = start; j < end; ++j) {
+            double* row_j = data + j * n;
+            d[j] = row_j[j] - weighted_dot(row_j, row_j, start, j);
+            if (d[j] == 0.0) {
+                singular_ = true;
+                return;
+            }
+            row_j[j] = 1.0;
+            for (std::size_t i = j + 1; i < end; ++i) {
+                double* row_i = data + i * n;
+                row_i[j] = (row_i[j] - weighted_dot(row_i, row_j, start, j)) / d[j];
+            }
+        }
+        if (end == n) {
+            break;
+        }
+
+        // L21 = A21 * L11^-T * D1^-1
+        parallel::ParallelFor(end, n, 2 * width * width, [=](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                double* row_i = data + i * n;
+                for (std::size_t j = start; j < end; ++j) {
+                    row_i[j] = (row_i[j] - weighted_dot(row_i, data + j * n, start, j)) / d[j];
+                }
+            }
+        });
+
+        // A22 -= (L21 * D1) * L21^T
+        const ConstMatrixView l21 = l_.Block(end, start, n - end, width);
+        Matrix scaled(n - end, width);
+        for (std::size_t r = 0; r < n - end; ++r) {
+            for (std::size_t c = 0; c < width; ++c) {
+                scaled.AtUnchecked(r, c) = l21.AtUnchecked(r, c) * d[start + c];
+            }
+        }
+        UpdateTrailing(l_, end, scaled, l21);
+    }
+}
+
+Matrix LDLTSolver::Solve(const Matrix& rhs) const {
+    Matrix result = rhs;
+    SolveInPlace(result);
+    return result;
+}
+
+void LDLTSolver::SolveInPlace(const MatrixView& rhs) const {
+    if (singular_) {
+        throw std::invalid_argument("matrix is singular");
+    }
+    if (rhs.Row() != l_.Row()) {
+        throw std::invalid_argument("check size, rhs should have as many rows as the matrix");
+    }
+    ForwardSubstitution(l_, rhs, true);
+    for (std::size_t i = 0; i < l_.Row(); ++i) {
+        kernel::Scale(1.0 / d_.AtUnchecked(i, 0), rhs.RowView(i));
+    }
+    BackwardSubstitution(l_, rhs, true);
+}
+
+Matrix LDLTSolver::Inverse() const {
+    Matrix result = Matrix::Identity(l_.Row());
+    SolveInPlace(result);
+    return result;
+}
+
+double LDLTSolver::Determinant() const {
+    if (singular_) {
+        return 0.0;
+    }
+    double det = 1.0;
+    for (std::size_t i = 0; i < d_.Row(); ++i) {
+        det *= d_.AtUnchecked(i, 0);
+    }
+    return det;
+}
+
+std::pair<double, double> LDLTSolver::LogDeterminant() const {
+    if (singular_) {
+        return std::make_pair(0.0, -std::numeric_limits<double>::infinity());
+    }
+    double sign = 1.0;
+    double log_abs = 0.0;
+    for (std::size_t i = 0; i < d_.Row(); ++i) {
+        const double value = d_.AtUnchecked(i, 0);
+        if (value < 0.0) {
+            sign = -sign;
+        }
+        log_abs += std::log(std::abs(value));
+    }
+    return std::make_pair(sign, log_abs);
+}
+
+Matrix LDLTSolver::Lower() const { return l_; }
+
+Matrix LDLTSolver::Diagonal() const { return d_; }
+
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,96 @@
+/// @file matrix_cholesky_solver.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Cholesky (L * L^T) and L * D * L^T decompositions of symmetric matrices.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_CHOLESKY_SOLVER_H_
+#define SRC_MATRIX_MATRIX_CHOLESKY_SOLVER_H_
+
+#include <utility>
+
+#include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_view.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Factors a symmetric positive definite matrix once as A = L * L^T, then solves against any number of right
+/// hand sides. Only the lower triangle of A is read. Half the flops of LUSolver and no pivoting is needed. The
+/// factorization is blocked and right-looking, the trailing update runs on the GEMM kernel over the tiles of the lower
+/// triangle in parallel.
+class CholeskySolver {
+ public:
+    explicit CholeskySolver(const Matrix& mat);
+
+    /// @brief A non-positive pivot was met, so A is not positive definite (or too ill-conditioned to tell). Every
+    /// other method throws in that case.
+    bool IsPositiveDefinite() const;
+
+    /// @brief Solves A * X = B. B is n x m, a column vector or a block of right hand sides.
+    Matrix Solve(const Matrix& rhs) const;
+    /// @brief Solves A * X = B and overwrites B with X.
+    void SolveInPlace(const MatrixView& rhs) const;
+
+    Matrix Inverse() const;
+    double Determinant() const;
+    /// @brief {1, log det}, summed from the diagonal of L so it does not overflow.
+    std::pair<double, double> LogDeterminant() const;
+
+    /// @brief Lower triangular factor L with a positive diagonal.
+    Matrix Lower() const;
+
+    /// @brief Refactors A + x * x^T from the current factor in O(n^2). x is n x 1.
+    void Update(const Matrix& x);
+    /// @brief Refactors A - x * x^T in O(n^2). Throws and keeps the factor unchanged when the result would not be
+    /// positive definite.
+    void Downdate(const Matrix& x);
+
+ private:
+    void Factorize();
+    void CheckPositiveDefinite() const;
+    void CheckVector(const Matrix& x) const;
+
+    Matrix l_{};
+    bool positive_definite_{true};
+};
+
+/// @brief Factors a symmetric matrix as A = L * D * L^T with L unit lower triangular and D diagonal, without square
+/// roots. There is no pivoting, so it is meant for positive definite and quasi-definite matrices (e.g. saddle point
+/// systems with a positive and a negative definite block); an indefinite A can break down or lose accuracy where
+/// LUSolver would not. Only the lower triangle of A is read.
+class LDLTSolver {
+ public:
+    explicit LDLTSolver(const Matrix& mat);
+
+    /// @brief A zero pivot was met. Solve and Inverse throw on singular matrices, Determinant returns 0.
+    bool IsSingular() const;
+
+    Matrix Solve(const Matrix& rhs) const;
+    void SolveInPlace(const MatrixView& rhs) const;
+
+    Matrix Inverse() const;
+    double Determinant() const;
+    /// @brief {sign, log|det|} from D. Singular gives {0, -inf}.
+    std::pair<double, double> LogDeterminant() const;
+
+    /// @brief Unit lower triangular factor L.
+    Matrix Lower() const;
+    /// @brief n x 1 diagonal of D. The signs of D are the signs of the eigenvalues of A (Sylvester's law of inertia).
+    Matrix Diagonal() const;
+
+ private:
+    void Factorize();
+
+    Matrix l_{};
+    Matrix d_{};
+    bool singular_{false};
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_CHOLESKY_SOLVER_H_
@@ -10,15 +10,22 @@
 #include "src/matrix/matrix_core.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <initializer_list>
-#include <limits>
+#include <numeric>
 #include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "src/matrix/matrix_kernel.h"
+#include "src/matrix/matrix_lu_solver.h"
 #include "src/matrix/matrix_operation.h"
+#include "src/matrix/matrix_simd.h"
+#include "src/matrix/matrix_view.h"
+#include "src/memory/workspace.h"
+#include "src/parallel/thread_pool.h"
 #include "src/random/random.h"
 
 namespace math_cpp {
@@ -26,39 +33,61 @@ namespace matrix {
 
 // using std::string_literals::operator""s;
 
+namespace {
+// Reductions are summed per block of this many elements, whatever the number of threads.
+constexpr std::size_t kReductionBlock = std::size_t{1} << 14;
+}  // namespace
+
 Matrix::Matrix(std::size_t row, std::size_t col, double value)
-    : data_(std::vector<double>(row * col, value)), row_(row), col_(col) {}
+    : data_(row * col, value), row_(row), col_(col) {}
 
 Matrix::Matrix(std::size_t row, std::size_t col) : Matrix(row, col, 0.0) {}
 
 Matrix::Matrix(const Shape& shape) : Matrix(shape.first, shape.second) {}
 
 Matrix::Matrix(const std::initializer_list<std::initializer_list<double>>& l)
-    : data_{}, row_{l.size()}, col_{l.begin()->size()} {
+    : data_(std::accumulate(l.begin(), l.end(), std::size_t{0},
+                            [](std::size_t sum, const std::initializer_list<double>& row) { return sum + row.size(); }),
+            0.0),
+      row_{l.size()},
+      col_{l.begin()->size()} {
+    double* dst = data_.Data();
     for (auto row : l) {
-        data_.insert(data_.end(), row.begin(), row.end());
+        dst = std::copy(row.begin(), row.end(), dst);
     }
 }
 
 std::size_t Matrix::Row() const { return row_; }
 std::size_t Matrix::Col() const { return col_; }
 
-double& Matrix::operator()(std::size_t row, std::size_t col) {
-    if (!IsBoundedSize(row, col)) {
-        std::string throw_msg =
-            "shape should be less or equal to <" + std::to_string(row_) + ", " + std::to_string(col_) + ">!";
-        throw std::invalid_argument(throw_msg);
-    }
-    return data_[row * col_ + col];
+void Matrix::ThrowOutOfBounds(std::size_t row, std::size_t col) const {
+    std::string throw_msg = "index <" + std::to_string(row) + ", " + std::to_string(col) + "> should be less than <" +
+                            std::to_string(row_) + ", " + std::to_string(col_) + ">!";
+    throw std::invalid_argument(throw_msg);
 }
 
-double Matrix::operator()(std::size_t row, std::size_t col) const {
-    if (!IsBoundedSize(row, col)) {
-        std::string throw_msg =
-            "shape should be less or equal to <" + std::to_string(row_) + ", " + std::to_string(col_) + ">!";
-        throw std::invalid_argument(throw_msg);
-    }
-    return data_[row * col_ + col];
+double* Matrix::Data() { return data_.Data(); }
+
+const double* Matrix::Data() const { return data_.Data(); }
+
+MatrixView Matrix::View() { return MatrixView(data_.Data(), row_, col_, col_, 1); }
+
+ConstMatrixView Matrix::View() const { return ConstMatrixView(data_.Data(), row_, col_, col_, 1); }
+
+MatrixView Matrix::RowView(std::size_t idx) { return View().RowView(idx); }
+
+ConstMatrixView Matrix::RowView(std::size_t idx) const { return View().RowView(idx); }
+
+MatrixView Matrix::ColView(std::size_t idx) { return View().ColView(idx); }
+
+ConstMatrixView Matrix::ColView(std::size_t idx) const { return View().ColView(idx); }
+
+MatrixView Matrix::Block(std::size_t start_row, std::size_t start_col, std::size_t rows, std::size_t cols) {
+    return View().Block(start_row, start_col, rows, cols);
+}
+
+ConstMatrixView Matrix::Block(std::size_t start_row, std::size_t start_col, std::size_t rows, std::size_t cols) const {
+    return View().Block(start_row, start_col, rows, cols);
 }
 
 Matrix& Matrix::operator+=(const Matrix& other) {
@@ -68,17 +97,28 @@ Matrix& Matrix::operator+=(const Matrix& other) {
         throw std::invalid_argument(throw_msg);
     }
 
-    auto this_it = data_.begin();
-    auto other_it = other.data_.begin();
-    for (; this_it != data_.end(); ++this_it, ++other_it) {
-        *this_it += *other_it;
-    }
+    double* dst = data_.Data();
+    const double* src = other.data_.Data();
+    parallel::ParallelFor(0, data_.Size(), 1, [dst, src](std::size_t first, std::size_t last) {
+        simd::Add(dst + first, src + first, dst + first, last - first);
+    });
 
     return *this;
 }
 
 Matrix& Matrix::operator-=(const Matrix& other) {
-    *this += -Matrix(other);
+    if (!IsSameSize(other)) {
+        std::string throw_msg =
+            "other matrix must be same size [*this] (" + std::to_string(row_) + ", " + std::to_string(col_) + ")!";
+        throw std::invalid_argument(throw_msg);
+    }
+
+    double* dst = data_.Data();
+    const double* src = other.data_.Data();
+    parallel::ParallelFor(0, data_.Size(), 1, [dst, src](std::size_t first, std::size_t last) {
+        simd::Sub(dst + first, src + first, dst + first, last - first);
+    });
+
     return *this;
 }
 
@@ -116,53 +156,42 @@ bool Matrix::operator==(const Matrix& other) const {
 
 bool Matrix::operator!=(const Matrix& other) const { return !(*this == other); }
 
-Matrix Matrix::Inverse() const {
-    if (row_ != col_) {
-        throw std::invalid_argument("matrix should be square");
-    }
-
-    Matrix eye = Identity(row_);
-    Matrix cat = Concatenate(*this, eye, 1);
+Matrix Matrix::Inverse() const { return LUSolver(*this).Inverse(); }
 
-    // Gauss Elimination
-    for (std::size_t i = 0; i < row_ - 1; ++i) {
-        cat.RowMult(i, 1 / cat(i, i));
-        Matrix row_matrix = cat.GetRow(i);
-
-        for (std::size_t j = i + 1; j < row_; ++j) {
-            Matrix temporal_row = row_matrix * (-cat(j, i));
-            cat.RowAdd(j, temporal_row);
-        }
+void Matrix::Inverse(memory::Workspace& workspace, Matrix& result) const {
+    // Sized before the frame, the result outlives the workspace memory.
+    if (!result.IsSameSize(*this)) {
+        result = Matrix(row_, col_);
     }
-
-    // Jordan Elimination
-    for (std::size_t i = row_ - 1; i > 0; --i) {
-        cat.RowMult(i, 1 / cat(i, i));
-        Matrix row_matrix = cat.GetRow(i);
-
-        for (std::size_t j = i - 1; j != std::numeric_limits<std::size_t>::max(); --j) {
-            Matrix temporal_row = row_matrix * (-cat(j, i));
-            cat.RowAdd(j, temporal_row);
-        }
+    memory::Workspace::Frame frame(workspace);
+    LUSolver solver(*this);
+    std::fill(result.data_.begin(), result.data_.end(), 0.0);
+    for (std::size_t i = 0; i < row_; ++i) {
+        result.AtUnchecked(i, i) = 1.0;
     }
-
-    Matrix result = cat.GetSubMatrix(0, col_);
-
-    return result;
+    solver.SolveInPlace(result);
 }
 
 Matrix Matrix::Transpose() const {
     Matrix result(col_, row_);
-    for (std::size_t row = 0; row < row_; ++row) {
-        for (std::size_t col = 0; col < col_; ++col) {
-            result(col, row) = (*this)(row, col);
-        }
-    }
+    kernel::Transpose(View(), result);
     return result;
 }
 
+Matrix& Matrix::TransposeInPlace() {
+    if (row_ == col_) {
+        kernel::TransposeInPlace(View());
+    } else {
+        *this = Transpose();
+    }
+    return *this;
+}
+
 Matrix& Matrix::Absolute() {
-    std::transform(std::begin(data_), std::end(data_), std::begin(data_), [](double& elm) { return std::abs(elm); });
+    double* dst = data_.Data();
+    parallel::ParallelFor(0, data_.Size(), 1, [dst](std::size_t first, std::size_t last) {
+        simd::Abs(dst + first, dst + first, last - first);
+    });
 
     return *this;
 }
@@ -171,35 +200,50 @@ double Matrix::Determinant(const Matrix& mat) {
     if (mat.row_ != mat.col_) {
         throw std::invalid_argument("determinant should be defined square matrix");
     }
-    if ((mat.row_ == 2) && (mat.col_ == 2)) {
-        return mat(0, 0) * mat(1, 1) - mat(1, 0) * mat(0, 1);
+
+    // Closed forms up to 3x3, pivoted LU above.
+    const double* a = mat.data_.Data();
+    switch (mat.row_) {
+        case 0:
+            return 1.0;
+        case 1:
+            return a[0];
+        case 2:
+            return a[0] * a[3] - a[2] * a[1];
+        case 3:
+            return a[0] * (a[4] * a[8] - a[5] * a[7]) - a[1] * (a[3] * a[8] - a[5] * a[6]) +
+                   a[2] * (a[3] * a[7] - a[4] * a[6]);
+        default:
+            return LUSolver(mat).Determinant();
     }
+}
 
-    std::size_t r = 0, c = 0;
-    int8_t sign = 1;
-    double det = 0.0;
-    for (c = 0; c < mat.col_; ++c) {
-        double sub_det = sign * mat(r, c) * Determinant(EraseRowCol(mat, r, c));
-        sign *= -1;
+double Matrix::Determinant(const Matrix& mat, memory::Workspace& workspace) {
+    memory::Workspace::Frame frame(workspace);
+    return Determinant(mat);
+}
 
-        det += sub_det;
+std::pair<double, double> Matrix::LogDeterminant(const Matrix& mat) {
+    if (mat.row_ != mat.col_) {
+        throw std::invalid_argument("determinant should be defined square matrix");
     }
+    return LUSolver(mat).LogDeterminant();
+}
 
-    return det;
+std::pair<double, double> Matrix::LogDeterminant(const Matrix& mat, memory::Workspace& workspace) {
+    memory::Workspace::Frame frame(workspace);
+    return LogDeterminant(mat);
 }
 
 Matrix Matrix::EraseRowCol(const Matrix& mat, std::size_t row, std::size_t col) {
     Matrix result(mat.row_ - 1, mat.col_ - 1);
-    std::size_t rr = 0, cc = 0;
-    for (std::size_t r = 0; r < mat.row_; ++r) {
-        cc = 0;
-        for (std::size_t c = 0; c < mat.col_; ++c) {
-            if ((r != row) && (c != col)) {
-                result(rr, cc++) = mat(r, c);
-            }
-        }
-        if (r != row) rr++;
-    }
+    // The four blocks around the erased row and column keep their relative position.
+    const std::size_t below = mat.row_ - row - 1;
+    const std::size_t right = mat.col_ - col - 1;
+    kernel::Copy(mat.Block(0, 0, row, col), result.Block(0, 0, row, col));
+    kernel::Copy(mat.Block(0, col + 1, row, right), result.Block(0, col, row, right));
+    kernel::Copy(mat.Block(row + 1, 0, below, col), result.Block(row, 0, below, col));
+    kernel::Copy(mat.Block(row + 1, col + 1, below, right), result.Block(row, col, below, right));
     return result;
 }
 
@@ -210,17 +254,15 @@ Matrix::operator double() {
         throw std::invalid_argument("Matrix to double type casting should be 1 x 1 size matrix");
     }
 
-    return (*this)(0, 0);
+    return AtUnchecked(0, 0);
 }
 
 Matrix& Matrix::RowMult(std::size_t idx, double scalar) {
     if (idx >= row_) {
         throw std::invalid_argument("check row index");
     }
-    auto start = std::next(std::begin(data_), static_cast<std::ptrdiff_t>(idx * col_));
-    auto finish = std::next(start, static_cast<std::ptrdiff_t>(col_));
-
-    std::transform(start, finish, start, [scalar](double elm) { return elm * scalar; });
+    double* row_start = data_.Data() + idx * col_;
+    simd::Scale(scalar, row_start, row_start, col_);
 
     return *this;
 }
@@ -232,46 +274,15 @@ Matrix& Matrix::RowAdd(std::size_t idx, const Matrix& row) {
     if (idx >= row_) {
         throw std::invalid_argument("check row index");
     }
-    auto start = std::next(std::begin(data_), static_cast<std::ptrdiff_t>(idx * col_));
-    auto finish = std::next(start, static_cast<std::ptrdiff_t>(col_));
-    auto row_start = std::cbegin(row.data_);
-
-    std::transform(start, finish, start, [&row_start](double elm) { return elm + (*(row_start++)); });
+    double* row_start = data_.Data() + idx * col_;
+    simd::Add(row_start, row.data_.Data(), row_start, col_);
 
     return *this;
 }
 
-Matrix Matrix::GetCol(std::size_t idx) const {
-    if (idx >= col_) {
-        throw std::invalid_argument("check col index");
-    }
-
-    Matrix result(row_, 1);
-
-    Matrix transposed = (*this).Transpose();
+Matrix Matrix::GetCol(std::size_t idx) const { return ColView(idx).ToMatrix(); }
 
-    auto start = std::next(std::begin(transposed.data_), static_cast<std::ptrdiff_t>(idx * row_));
-    auto finish = std::next(start, static_cast<std::ptrdiff_t>(row_));
-    auto col_start = std::begin(result.data_);
-    std::copy(start, finish, col_start);
-
-    return result;
-}
-
-Matrix Matrix::GetRow(std::size_t idx) const {
-    if (idx >= row_) {
-        throw std::invalid_argument("check row index");
-    }
-
-    Matrix row_matrix(1, col_);
-
-    auto start = std::next(std::begin(data_), static_cast<std::ptrdiff_t>(idx * col_));
-    auto finish = std::next(start, static_cast<std::ptrdiff_t>(col_));
-    auto row_start = std::begin(row_matrix.data_);
-    std::copy(start, finish, row_start);
-
-    return row_matrix;
-}
+Matrix Matrix::GetRow(std::size_t idx) const { return RowView(idx).ToMatrix(); }
 
 Matrix& Matrix::SetRow(std::size_t idx, const Matrix& src) {
     if (src.col_ != 1) {
@@ -281,32 +292,19 @@ Matrix& Matrix::SetRow(std::size_t idx, const Matrix& src) {
         throw std::invalid_argument("Set row method should be same row");
     }
 
-    Matrix transposed_this = (*this).Transpose();
-    auto start = std::begin(transposed_this.data_);
-
-    std::copy(std::begin(src.data_), std::end(src.data_), std::next(start, static_cast<std::ptrdiff_t>(idx * col_)));
-
-    *this = transposed_this.Transpose();
+    kernel::Copy(src, ColView(idx));
     return *this;
 }
 
 Matrix Matrix::GetSubMatrix(std::size_t start_row, std::size_t start_col) {
-    Matrix result(row_ - start_row, col_ - start_col);
-
-    std::size_t target_row = 0;
-    for (std::size_t row = start_row; row < row_; ++row, ++target_row) {
-        std::size_t target_col = 0;
-        for (std::size_t col = start_col; col < col_; ++col, ++target_col) {
-            result(target_row, target_col) = (*this)(row, col);
-        }
-    }
-    return result;
+    return Block(start_row, start_col, row_ - start_row, col_ - start_col).ToMatrix();
 }
 
 Matrix& Matrix::operator*=(double scalar) {
-    auto start = std::begin(data_);
-    auto finish = std::end(data_);
-    std::transform(start, finish, start, [&scalar](double& elm) { return elm * scalar; });
+    double* dst = data_.Data();
+    parallel::ParallelFor(0, data_.Size(), 1, [dst, scalar](std::size_t first, std::size_t last) {
+        simd::Scale(scalar, dst + first, dst + first, last - first);
+    });
 
     return *this;
 }
@@ -316,11 +314,7 @@ bool Matrix::IsSameSize(const Matrix& other) const { return (row_ == other.row_)
 bool Matrix::CanMultiply(const Matrix& other) const { return (col_ == other.row_); }
 
 Matrix& Matrix::Copy(std::size_t start_row, std::size_t start_col, const Matrix& other) {
-    for (std::size_t r = 0; r < other.row_; ++r) {
-        for (std::size_t c = 0; c < other.col_; ++c) {
-            (*this)(r + start_row, c + start_col) = other(r, c);
-        }
-    }
+    kernel::Copy(other.View(), Block(start_row, start_col, other.row_, other.col_));
 
     return *this;
 }
@@ -356,35 +350,43 @@ Matrix Matrix::Concatenate(const Matrix& lhs, const Matrix& rhs, std::size_t axi
 Matrix Matrix::Identity(std::size_t size) {
     Matrix result(size, size);
     for (std::size_t index = 0; index < size; ++index) {
-        result(index, index) = 1.0;
+        result.AtUnchecked(index, index) = 1.0;
     }
 
     return result;
 }
 
-Matrix Matrix::Random(std::size_t row, std::size_t col) {
-    Matrix result(row, col);
-
-    random::Random instance = random::Random::GetInstance();
-    for (auto& elm : result.data_) {
-        elm = instance.Gaussian();
-    }
+Matrix Matrix::Random(std::size_t row, std::size_t col) { return Random(row, col, random::Random::GetInstance()); }
 
+Matrix Matrix::Random(std::size_t row, std::size_t col, random::Random& generator) {
+    Matrix result(row, col);
+    random::FillGaussian(generator, result.data_.Data(), result.data_.Size());
     return result;
 }
 
 double Matrix::Norm2(const Matrix& mat) {
-    double result = 0.0;
+    const double* src = mat.data_.Data();
+    const std::size_t size = mat.data_.Size();
+    if (size <= kReductionBlock) {
+        return std::sqrt(simd::SumSquares(src, size));
+    }
 
-    result = std::accumulate(std::begin(mat.data_), std::end(mat.data_), 0.0,
-                             [](double a, double b) { return a + (b * b); });
+    // Partial sums over fixed blocks keep the result independent of the number of threads.
+    const std::size_t blocks = (size + kReductionBlock - 1) / kReductionBlock;
+    memory::Vector<double> partial(blocks);
+    parallel::ParallelFor(0, blocks, kReductionBlock, [&](std::size_t first, std::size_t last) {
+        for (std::size_t block = first; block < last; ++block) {
+            const std::size_t offset = block * kReductionBlock;
+            partial[block] = simd::SumSquares(src + offset, std::min(kReductionBlock, size - offset));
+        }
+    });
 
-    return std::sqrt(result);
+    return std::sqrt(std::accumulate(std::begin(partial), std::end(partial), 0.0));
 }
 
-bool Matrix::IsBoundedRow(std::size_t row) const { return (row <= row_); }
+bool Matrix::IsBoundedRow(std::size_t row) const { return (row < row_); }
 
-bool Matrix::IsBoundedCol(std::size_t col) const { return (col <= col_); }
+bool Matrix::IsBoundedCol(std::size_t col) const { return (col < col_); }
 
 bool Matrix::IsBoundedSize(std::size_t row, std::size_t col) const { return IsBoundedRow(row) && IsBoundedCol(col); }
 
@@ -15,8 +15,23 @@
 #include <utility>
 #include <vector>
 
+#include "src/matrix/matrix_storage.h"
+
 namespace math_cpp {
+namespace memory {
+class Workspace;
+}  // namespace memory
+
+namespace random {
+class Random;
+}  // namespace random
+
 namespace matrix {
+template <typename T>
+class BasicMatrixView;
+using MatrixView = BasicMatrixView<double>;
+using ConstMatrixView = BasicMatrixView<const double>;
+
 class Matrix {
  public:
     using Shape = std::pair<std::size_t, std::size_t>;
@@ -45,7 +60,12 @@ class Matrix {
     bool operator!=(const Matrix& other) const;
 
     Matrix Inverse() const;
+    /// @brief Writes the inverse into result with the temporaries in workspace. result keeps its buffer when it
+    /// already has the shape, so repeated calls allocate nothing.
+    void Inverse(memory::Workspace& workspace, Matrix& result) const;
     Matrix Transpose() const;
+    /// @brief Transposes without allocating when the matrix is square, through a temporary otherwise.
+    Matrix& TransposeInPlace();
 
     Matrix& Absolute();
 
@@ -56,8 +76,33 @@ class Matrix {
     Matrix& SetRow(std::size_t idx, const Matrix& src);
     Matrix GetSubMatrix(std::size_t start_row, std::size_t start_col);
 
-    double& operator()(std::size_t row, std::size_t col);
-    double operator()(std::size_t row, std::size_t col) const;
+    /// Zero-copy views, see matrix_view.h. They are invalidated when the matrix is resized or destroyed.
+    MatrixView View();
+    ConstMatrixView View() const;
+    MatrixView RowView(std::size_t idx);
+    ConstMatrixView RowView(std::size_t idx) const;
+    MatrixView ColView(std::size_t idx);
+    ConstMatrixView ColView(std::size_t idx) const;
+    MatrixView Block(std::size_t start_row, std::size_t start_col, std::size_t rows, std::size_t cols);
+    ConstMatrixView Block(std::size_t start_row, std::size_t start_col, std::size_t rows, std::size_t cols) const;
+
+    /// @brief Element access. Bounds are checked only when the library is built with MATH_CPP_BOUNDS_CHECK, which
+    /// OPTION_BOUNDS_CHECK and Debug builds define. Out of range access is undefined otherwise.
+    double& operator()(std::size_t row, std::size_t col) {
+        CheckBounds(row, col);
+        return AtUnchecked(row, col);
+    }
+    double operator()(std::size_t row, std::size_t col) const {
+        CheckBounds(row, col);
+        return AtUnchecked(row, col);
+    }
+
+    /// @brief Element access that is never checked, for loops whose indices are correct by construction.
+    double& AtUnchecked(std::size_t row, std::size_t col) { return data_[row * col_ + col]; }
+    double AtUnchecked(std::size_t row, std::size_t col) const { return data_[row * col_ + col]; }
+
+    double* Data();
+    const double* Data() const;
 
     friend std::ostream& operator<<(std::ostream& os, const Matrix& mat);
 
@@ -68,10 +113,19 @@ class Matrix {
 
     static Matrix Concatenate(const Matrix& lhs, const Matrix& rhs, std::size_t axis = 0);
     static Matrix Identity(std::size_t size);
+    /// @brief Standard normal elements from the generator of the calling thread.
     static Matrix Random(std::size_t row, std::size_t col);
+    /// @brief Standard normal elements from generator, e.g. random::Random(seed, stream) for a reproducible matrix.
+    /// Filled by random::FillGaussian, in parallel blocks.
+    static Matrix Random(std::size_t row, std::size_t col, random::Random& generator);
 
     static double Norm2(const Matrix& mat);
     static double Determinant(const Matrix& mat);
+    static double Determinant(const Matrix& mat, memory::Workspace& workspace);
+    /// @brief Sign and log of the absolute value of the determinant, {sign, log|det|}. Does not overflow for large
+    /// matrices. A singular matrix gives {0, -inf}.
+    static std::pair<double, double> LogDeterminant(const Matrix& mat);
+    static std::pair<double, double> LogDeterminant(const Matrix& mat, memory::Workspace& workspace);
     static Matrix EraseRowCol(const Matrix& mat, std::size_t row, std::size_t col);
 
     static Matrix Zeros(const Matrix& mat);
@@ -79,10 +133,22 @@ class Matrix {
     explicit operator double();
 
  private:
+    void CheckBounds(std::size_t row, std::size_t col) const {
+#ifdef MATH_CPP_BOUNDS_CHECK
+        if (!IsBoundedSize(row, col)) {
+            ThrowOutOfBounds(row, col);
+        }
+#else
+        static_cast<void>(row);
+        static_cast<void>(col);
+#endif
+    }
+    /// Builds the message out of line, so the checked accessors stay small enough to inline.
+    [[noreturn]] void ThrowOutOfBounds(std::size_t row, std::size_t col) const;
     bool IsBoundedRow(std::size_t row) const;
     bool IsBoundedCol(std::size_t col) const;
     bool IsBoundedSize(std::size_t row, std::size_t col) const;
-    std::vector<double> data_{};
+    Storage data_{};
     std::size_t row_{};
     std::size_t col_{};
 };
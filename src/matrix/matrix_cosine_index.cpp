@@ -0,0 +1,169 @@
+/// @file matrix_cosine_index.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_cosine_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include "src/matrix/matrix_kernel.h"
+#include "src/matrix/matrix_simd.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+
+namespace {
+// Corpus rows scored per GEMM. With 128-dimensional embeddings a block is 1 MiB and stays in L2 for all query blocks.
+constexpr std::size_t kCorpusBlock = 1024;
+// Queries scored per GEMM, the score block is at most 2 MiB.
+constexpr std::size_t kQueryBlock = 256;
+
+struct Candidate {
+    double score;
+    std::size_t index;
+};
+
+/// Higher score first, then lower corpus row, so that the result does not depend on the split of the corpus.
+bool Better(const Candidate& lhs, const Candidate& rhs) {
+    return (lhs.score > rhs.score) || ((lhs.score == rhs.score) && (lhs.index < rhs.index));
+}
+
+/// Keeps the k best candidates offered so far with the worst of them at heap[0], so most candidates are rejected by a
+/// single comparison.
+void Offer(Candidate* heap, std::size_t& count, std::size_t k, const Candidate& candidate) {
+    if (count < k) {
+        heap[count++] = candidate;
+        std::push_heap(heap, heap + count, Better);
+        return;
+    }
+    if (!Better(candidate, heap[0])) {
+        return;
+    }
+    std::pop_heap(heap, heap + k, Better);
+    heap[k - 1] = candidate;
+    std::push_heap(heap, heap + k, Better);
+}
+}  // namespace
+
+CosineIndex::CosineIndex(const Matrix& corpus) : corpus_(corpus) { CacheNorms(); }
+
+CosineIndex::CosineIndex(Matrix&& corpus) : corpus_(std::move(corpus)) { CacheNorms(); }
+
+std::size_t CosineIndex::Size() const { return corpus_.Row(); }
+
+std::size_t CosineIndex::Dimension() const { return corpus_.Col(); }
+
+void CosineIndex::CacheNorms() {
+    const std::size_t n = corpus_.Row();
+    const std::size_t d = corpus_.Col();
+    inverse_norms_ = memory::Vector<double>(n);
+    const double* data = corpus_.Data();
+    double* inverse = inverse_norms_.data();
+    parallel::ParallelFor(0, n, d, [=](std::size_t first, std::size_t last) {
+        for (std::size_t r = first; r < last; ++r) {
+            const double norm = std::sqrt(simd::SumSquares(data + r * d, d));
+            inverse[r] = (norm > 0.0) ? 1.0 / norm : 0.0;
+        }
+    });
+}
+
+CosineIndex::Neighbors CosineIndex::Search(const Matrix& queries, std::size_t k) const {
+    const std::size_t n = Size();
+    const std::size_t d = Dimension();
+    const std::size_t q = queries.Row();
+    if (queries.Col() != d) {
+        throw std::invalid_argument("check size, queries should have as many columns as the corpus");
+    }
+    if ((k == 0) || (k > n)) {
+        throw std::invalid_argument("check k, it should be 1 <= k <= corpus rows");
+    }
+
+    Neighbors result{Matrix(q, k), memory::Vector<std::size_t>(q * k)};
+    if (q == 0) {
+        return result;
+    }
+
+    // Unit queries, so a score only needs the cached inverse norm of its corpus row.
+    Matrix normalized(q, d);
+    parallel::ParallelFor(0, q, d, [&queries, &normalized, d](std::size_t first, std::size_t last) {
+        for (std::size_t r = first; r < last; ++r) {
+            const double* query = queries.Data() + r * d;
+            const double norm = std::sqrt(simd::SumSquares(query, d));
+            simd::Scale((norm > 0.0) ? 1.0 / norm : 0.0, query, normalized.Data() + r * d, d);
+        }
+    });
+
+    // Tasks are pairs of a query block and a contiguous part of the corpus. Each part keeps its own heaps, and there
+    // are only as many parts as the query blocks leave workers idle, so the heaps stay small for large batches.
+    const std::size_t blocks = (n + kCorpusBlock - 1) / kCorpusBlock;
+    const std::size_t query_blocks = (q + kQueryBlock - 1) / kQueryBlock;
+    const std::size_t workers = parallel::ThreadPool::GetInstance().WorkerCount();
+    const std::size_t parts = std::max<std::size_t>(1, std::min(blocks, workers / query_blocks));
+    memory::Vector<Candidate> heaps(parts * q * k);
+    memory::Vector<std::size_t> counts(parts * q);
+    const std::size_t score_rows = std::min(q, kQueryBlock);
+    const std::size_t score_cols = std::min(n, kCorpusBlock);
+
+    const std::size_t tasks = query_blocks * parts;
+    parallel::ParallelFor(0, tasks, 2 * score_rows * d * (n / parts), [&](std::size_t first, std::size_t last) {
+        Matrix scores(score_rows, score_cols);
+        for (std::size_t task = first; task < last; ++task) {
+            const std::size_t part = task % parts;
+            const std::size_t query_begin = task / parts * kQueryBlock;
+            const std::size_t count = std::min(kQueryBlock, q - query_begin);
+            Candidate* part_heaps = heaps.data() + part * q * k;
+            std::size_t* part_counts = counts.data() + part * q;
+            for (std::size_t block = part * blocks / parts; block < (part + 1) * blocks / parts; ++block) {
+                const std::size_t row_begin = block * kCorpusBlock;
+                const std::size_t rows = std::min(kCorpusBlock, n - row_begin);
+                const double* inverse = inverse_norms_.data() + row_begin;
+                kernel::Gemm(1.0, normalized.Block(query_begin, 0, count, d),
+                             corpus_.Block(row_begin, 0, rows, d).Transpose(), 0.0, scores.Block(0, 0, count, rows));
+                for (std::size_t i = 0; i < count; ++i) {
+                    double* score = scores.Data() + i * score_cols;
+                    for (std::size_t j = 0; j < rows; ++j) {
+                        score[j] *= inverse[j];
+                    }
+                    const std::size_t query = query_begin + i;
+                    for (std::size_t j = 0; j < rows; ++j) {
+                        Offer(part_heaps + query * k, part_counts[query], k, Candidate{score[j], row_begin + j});
+                    }
+                }
+            }
+        }
+    });
+
+    // Every part holds min(k, its rows) candidates per query and the parts cover the corpus, so there are at least k.
+    parallel::ParallelFor(0, q, parts * k, [&](std::size_t first, std::size_t last) {
+        memory::Vector<Candidate> merged{};
+        merged.reserve(parts * k);
+        for (std::size_t query = first; query < last; ++query) {
+            merged.clear();
+            for (std::size_t part = 0; part < parts; ++part) {
+                const Candidate* heap = heaps.data() + (part * q + query) * k;
+                merged.insert(std::end(merged), heap, heap + counts[part * q + query]);
+            }
+            std::partial_sort(std::begin(merged), std::begin(merged) + static_cast<std::ptrdiff_t>(k),
+                              std::end(merged), Better);
+            for (std::size_t j = 0; j < k; ++j) {
+                result.scores(query, j) = merged[j].score;
+                result.indices[query * k + j] = merged[j].index;
+            }
+        }
+    });
+    return result;
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,58 @@
+/// @file matrix_cosine_index.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Batched top-k cosine similarity search over the rows of a matrix.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_COSINE_INDEX_H_
+#define SRC_MATRIX_MATRIX_COSINE_INDEX_H_
+
+#include <cstddef>
+
+#include "src/matrix/matrix_core.h"
+#include "src/memory/allocator.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Exact nearest neighbors by cosine similarity among the rows of an n x d corpus, one embedding per row.
+/// The inverse row norms are computed once. A search normalizes the queries and scores blocks of queries against
+/// blocks of corpus rows with one GEMM each, so a corpus block is read once per query block instead of once per
+/// query. Small batches split the corpus into contiguous parts, one per idle worker. Each part keeps its own k-element
+/// min-heap per query and the heaps are merged at the end, so the selection needs no locks.
+class CosineIndex {
+ public:
+    /// @brief q x k results, row i for query i in descending score. Equal scores are ordered by corpus row.
+    struct Neighbors {
+        Matrix scores{};
+        /// indices[i * k + j] is the corpus row of scores(i, j).
+        memory::Vector<std::size_t> indices{};
+    };
+
+    explicit CosineIndex(const Matrix& corpus);
+    /// @brief Takes over the corpus instead of copying it.
+    explicit CosineIndex(Matrix&& corpus);
+
+    /// @brief Rows of the corpus.
+    std::size_t Size() const;
+    /// @brief Columns of the corpus, the embedding dimension.
+    std::size_t Dimension() const;
+
+    /// @brief The k corpus rows most similar to each row of the q x d queries, 1 <= k <= Size().
+    /// Zero rows, in the corpus or the queries, score 0 against everything.
+    Neighbors Search(const Matrix& queries, std::size_t k) const;
+
+ private:
+    void CacheNorms();
+
+    Matrix corpus_{};
+    memory::Vector<double> inverse_norms_{};
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_COSINE_INDEX_H_
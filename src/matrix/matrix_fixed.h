@@ -0,0 +1,363 @@
+/// @file matrix_fixed.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Matrix with its shape fixed at compile time.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+/// FixedMatrix<R, C> keeps its elements inline (on the stack), so small matrices such as 3x3 rotations or 6x6
+/// covariances never allocate. Shapes are part of the type and are checked by the compiler, and every operation is
+/// constexpr. It is meant for small sizes, use Matrix beyond a few dozen elements per side.
+///
+#ifndef SRC_MATRIX_MATRIX_FIXED_H_
+#define SRC_MATRIX_MATRIX_FIXED_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_view.h"
+
+namespace math_cpp {
+namespace matrix {
+
+template <std::size_t R, std::size_t C>
+class FixedMatrix;
+
+namespace detail {
+constexpr double Abs(double value) { return (value < 0.0) ? -value : value; }
+
+/// Sum over k < K of lhs(row, k) * rhs(k, col), expanded at compile time.
+template <std::size_t K>
+struct UnrolledDot {
+    template <typename L, typename Rhs>
+    static constexpr double Apply(const L& lhs, const Rhs& rhs, std::size_t row, std::size_t col) {
+        return UnrolledDot<K - 1>::Apply(lhs, rhs, row, col) + lhs(row, K - 1) * rhs(K - 1, col);
+    }
+};
+template <>
+struct UnrolledDot<0> {
+    template <typename L, typename Rhs>
+    static constexpr double Apply(const L& /*lhs*/, const Rhs& /*rhs*/, std::size_t /*row*/, std::size_t /*col*/) {
+        return 0.0;
+    }
+};
+
+/// Closed forms are selected by size tag, 0 is the general pivoted path.
+template <std::size_t N>
+using SizeTag = std::integral_constant<std::size_t, (N <= 3) ? N : 0>;
+
+template <std::size_t N>
+constexpr double Determinant(const FixedMatrix<N, N>& m, std::integral_constant<std::size_t, 1> /*tag*/) {
+    return m(0, 0);
+}
+
+template <std::size_t N>
+constexpr double Determinant(const FixedMatrix<N, N>& m, std::integral_constant<std::size_t, 2> /*tag*/) {
+    return m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+}
+
+template <std::size_t N>
+constexpr double Determinant(const FixedMatrix<N, N>& m, std::integral_constant<std::size_t, 3> /*tag*/) {
+    return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0)) +
+           m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+}
+
+/// LU elimination with partial pivoting on a copy.
+template <std::size_t N>
+constexpr double Determinant(FixedMatrix<N, N> m, std::integral_constant<std::size_t, 0> /*tag*/) {
+    double det = 1.0;
+    for (std::size_t i = 0; i < N; ++i) {
+        std::size_t pivot = i;
+        for (std::size_t r = i + 1; r < N; ++r) {
+            if (Abs(m(r, i)) > Abs(m(pivot, i))) {
+                pivot = r;
+            }
+        }
+        if (m(pivot, i) == 0.0) {
+            return 0.0;
+        }
+        if (pivot != i) {
+            m.SwapRows(i, pivot);
+            det = -det;
+        }
+        det *= m(i, i);
+        for (std::size_t r = i + 1; r < N; ++r) {
+            const double factor = m(r, i) / m(i, i);
+            for (std::size_t c = i + 1; c < N; ++c) {
+                m(r, c) -= factor * m(i, c);
+            }
+        }
+    }
+    return det;
+}
+
+template <std::size_t N>
+constexpr FixedMatrix<N, N> Inverse(const FixedMatrix<N, N>& m, std::integral_constant<std::size_t, 1> /*tag*/) {
+    if (m(0, 0) == 0.0) {
+        throw std::invalid_argument("matrix is singular");
+    }
+    FixedMatrix<N, N> result{};
+    result(0, 0) = 1.0 / m(0, 0);
+    return result;
+}
+
+template <std::size_t N>
+constexpr FixedMatrix<N, N> Inverse(const FixedMatrix<N, N>& m, std::integral_constant<std::size_t, 2> /*tag*/) {
+    const double det = Determinant(m, std::integral_constant<std::size_t, 2>{});
+    if (det == 0.0) {
+        throw std::invalid_argument("matrix is singular");
+    }
+    FixedMatrix<N, N> result{};
+    result(0, 0) = m(1, 1) / det;
+    result(0, 1) = -m(0, 1) / det;
+    result(1, 0) = -m(1, 0) / det;
+    result(1, 1) = m(0, 0) / det;
+    return result;
+}
+
+/// Adjugate divided by the determinant.
+template <std::size_t N>
+constexpr FixedMatrix<N, N> Inverse(const FixedMatrix<N, N>& m, std::integral_constant<std::size_t, 3> /*tag*/) {
+    const double det = Determinant(m, std::integral_constant<std::size_t, 3>{});
+    if (det == 0.0) {
+        throw std::invalid_argument("matrix is singular");
+    }
+    FixedMatrix<N, N> result{};
+    result(0, 0) = (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) / det;
+    result(0, 1) = (m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2)) / det;
+    result(0, 2) = (m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)) / det;
+    result(1, 0) = (m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2)) / det;
+    result(1, 1) = (m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0)) / det;
+    result(1, 2) = (m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)) / det;
+    result(2, 0) = (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0)) / det;
+    result(2, 1) = (m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1)) / det;
+    result(2, 2) = (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) / det;
+    return result;
+}
+
+/// Gauss-Jordan elimination with partial pivoting.
+template <std::size_t N>
+constexpr FixedMatrix<N, N> Inverse(FixedMatrix<N, N> m, std::integral_constant<std::size_t, 0> /*tag*/) {
+    FixedMatrix<N, N> result = FixedMatrix<N, N>::Identity();
+    for (std::size_t i = 0; i < N; ++i) {
+        std::size_t pivot = i;
+        for (std::size_t r = i + 1; r < N; ++r) {
+            if (Abs(m(r, i)) > Abs(m(pivot, i))) {
+                pivot = r;
+            }
+        }
+        if (m(pivot, i) == 0.0) {
+            throw std::invalid_argument("matrix is singular");
+        }
+        m.SwapRows(i, pivot);
+        result.SwapRows(i, pivot);
+
+        const double scale = 1.0 / m(i, i);
+        for (std::size_t c = 0; c < N; ++c) {
+            m(i, c) *= scale;
+            result(i, c) *= scale;
+        }
+        for (std::size_t r = 0; r < N; ++r) {
+            if (r != i) {
+                const double factor = m(r, i);
+                for (std::size_t c = 0; c < N; ++c) {
+                    m(r, c) -= factor * m(i, c);
+                    result(r, c) -= factor * result(i, c);
+                }
+            }
+        }
+    }
+    return result;
+}
+}  // namespace detail
+
+template <std::size_t R, std::size_t C>
+class FixedMatrix {
+    static_assert((R > 0) && (C > 0), "FixedMatrix needs at least one row and one column");
+
+ public:
+    constexpr FixedMatrix() = default;
+    explicit constexpr FixedMatrix(double value) {
+        for (std::size_t i = 0; i < R * C; ++i) {
+            data_[i] = value;
+        }
+    }
+    constexpr FixedMatrix(const std::initializer_list<std::initializer_list<double>>& l) {
+        if (l.size() != R) {
+            throw std::invalid_argument("check row size");
+        }
+        std::size_t r = 0;
+        for (const auto& row : l) {
+            if (row.size() != C) {
+                throw std::invalid_argument("check column size");
+            }
+            std::size_t c = 0;
+            for (double value : row) {
+                data_[r * C + c++] = value;
+            }
+            ++r;
+        }
+    }
+
+    /// @brief Copies a dynamic matrix, its shape is checked at run time.
+    explicit FixedMatrix(const Matrix& mat) {
+        if ((mat.Row() != R) || (mat.Col() != C)) {
+            throw std::invalid_argument("check size, matrix shape differs from the fixed shape");
+        }
+        const double* src = mat.Data();
+        for (std::size_t i = 0; i < R * C; ++i) {
+            data_[i] = src[i];
+        }
+    }
+
+    static constexpr std::size_t Row() { return R; }
+    static constexpr std::size_t Col() { return C; }
+
+    /// Element access without bounds checking.
+    constexpr double& operator()(std::size_t row, std::size_t col) { return data_[row * C + col]; }
+    constexpr double operator()(std::size_t row, std::size_t col) const { return data_[row * C + col]; }
+
+    constexpr double* Data() { return data_; }
+    constexpr const double* Data() const { return data_; }
+
+    MatrixView View() { return MatrixView(data_, R, C, C, 1); }
+    ConstMatrixView View() const { return ConstMatrixView(data_, R, C, C, 1); }
+
+    Matrix ToMatrix() const { return View().ToMatrix(); }
+
+    static constexpr FixedMatrix Identity() {
+        static_assert(R == C, "identity should be square");
+        FixedMatrix result{};
+        for (std::size_t i = 0; i < R; ++i) {
+            result(i, i) = 1.0;
+        }
+        return result;
+    }
+
+    constexpr FixedMatrix<C, R> Transpose() const {
+        FixedMatrix<C, R> result{};
+        for (std::size_t r = 0; r < R; ++r) {
+            for (std::size_t c = 0; c < C; ++c) {
+                result(c, r) = (*this)(r, c);
+            }
+        }
+        return result;
+    }
+
+    /// @brief Closed form up to 3x3, pivoted Gauss-Jordan above. Throws std::invalid_argument if singular.
+    constexpr FixedMatrix Inverse() const {
+        static_assert(R == C, "matrix should be square");
+        return detail::Inverse(*this, detail::SizeTag<R>{});
+    }
+
+    /// @brief Closed form up to 3x3, pivoted LU above.
+    static constexpr double Determinant(const FixedMatrix& mat) {
+        static_assert(R == C, "determinant should be defined square matrix");
+        return detail::Determinant(mat, detail::SizeTag<R>{});
+    }
+
+    constexpr FixedMatrix& SwapRows(std::size_t lhs, std::size_t rhs) {
+        for (std::size_t c = 0; c < C; ++c) {
+            const double temp = (*this)(lhs, c);
+            (*this)(lhs, c) = (*this)(rhs, c);
+            (*this)(rhs, c) = temp;
+        }
+        return *this;
+    }
+
+    constexpr FixedMatrix& operator+=(const FixedMatrix& other) {
+        for (std::size_t i = 0; i < R * C; ++i) {
+            data_[i] += other.data_[i];
+        }
+        return *this;
+    }
+    constexpr FixedMatrix& operator-=(const FixedMatrix& other) {
+        for (std::size_t i = 0; i < R * C; ++i) {
+            data_[i] -= other.data_[i];
+        }
+        return *this;
+    }
+    constexpr FixedMatrix& operator*=(double scalar) {
+        for (std::size_t i = 0; i < R * C; ++i) {
+            data_[i] *= scalar;
+        }
+        return *this;
+    }
+    constexpr FixedMatrix& operator/=(double scalar) {
+        if (scalar == 0) {
+            throw std::invalid_argument("scalar must be not 0(ZERO)!");
+        }
+        return *this *= (1 / scalar);
+    }
+
+    /// Same tolerance as Matrix::operator==.
+    constexpr bool operator==(const FixedMatrix& other) const {
+        for (std::size_t i = 0; i < R * C; ++i) {
+            if (detail::Abs(data_[i] - other.data_[i]) > 1e-3) {
+                return false;
+            }
+        }
+        return true;
+    }
+    constexpr bool operator!=(const FixedMatrix& other) const { return !(*this == other); }
+
+ private:
+    double data_[R * C]{};
+};
+
+template <std::size_t R, std::size_t C>
+constexpr FixedMatrix<R, C> operator+(FixedMatrix<R, C> lhs, const FixedMatrix<R, C>& rhs) {
+    return lhs += rhs;
+}
+
+template <std::size_t R, std::size_t C>
+constexpr FixedMatrix<R, C> operator-(FixedMatrix<R, C> lhs, const FixedMatrix<R, C>& rhs) {
+    return lhs -= rhs;
+}
+
+template <std::size_t R, std::size_t C>
+constexpr FixedMatrix<R, C> operator*(FixedMatrix<R, C> lhs, double scalar) {
+    return lhs *= scalar;
+}
+
+template <std::size_t R, std::size_t C>
+constexpr FixedMatrix<R, C> operator*(double scalar, FixedMatrix<R, C> rhs) {
+    return rhs *= scalar;
+}
+
+template <std::size_t R, std::size_t C>
+constexpr FixedMatrix<R, C> operator/(FixedMatrix<R, C> lhs, double scalar) {
+    return lhs /= scalar;
+}
+
+/// @brief Product with the inner dimension checked by the compiler and each dot product unrolled.
+template <std::size_t R, std::size_t K, std::size_t C>
+constexpr FixedMatrix<R, C> operator*(const FixedMatrix<R, K>& lhs, const FixedMatrix<K, C>& rhs) {
+    FixedMatrix<R, C> result{};
+    for (std::size_t r = 0; r < R; ++r) {
+        for (std::size_t c = 0; c < C; ++c) {
+            result(r, c) = detail::UnrolledDot<K>::Apply(lhs, rhs, r, c);
+        }
+    }
+    return result;
+}
+
+template <std::size_t R, std::size_t C>
+std::ostream& operator<<(std::ostream& os, const FixedMatrix<R, C>& mat) {
+    return os << mat.ToMatrix();
+}
+
+using Matrix2d = FixedMatrix<2, 2>;
+using Matrix3d = FixedMatrix<3, 3>;
+using Matrix4d = FixedMatrix<4, 4>;
+using Matrix6d = FixedMatrix<6, 6>;
+
+}  // namespace matrix
+}  // namespace math_cpp
+
+#endif  // SRC_MATRIX_MATRIX_FIXED_H_
@@ -0,0 +1,224 @@
+/// @file matrix_gemm.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_gemm.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "src/matrix/matrix_simd.h"
+#include "src/memory/allocator.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+namespace kernel {
+
+namespace {
+// Micro tile computed by one call of the micro-kernel. The accumulator (kMR x kNR) is kept in registers.
+constexpr std::size_t kMR = 4;
+constexpr std::size_t kNR = 8;
+
+// Cache blocking. A B micro-panel (kKC x kNR) stays in L1, a packed A block (kMC x kKC) in L2 and a packed B panel
+// (kKC x kNC) in L3.
+constexpr std::size_t kKC = 256;
+constexpr std::size_t kMC = 128;
+constexpr std::size_t kNC = 4096;
+
+// Below this amount of multiply-adds, packing costs more than it saves.
+constexpr std::size_t kSmallWork = 32 * 32 * 32;
+
+using Tile = std::array<double, kMR * kNR>;
+
+void ScaleC(std::size_t m, std::size_t n, double beta, double* c, std::size_t rsc, std::size_t csc) {
+    for (std::size_t i = 0; i < m; ++i) {
+        double* c_row = c + i * rsc;
+        for (std::size_t j = 0; j < n; ++j) {
+            c_row[j * csc] = (beta == 0.0) ? 0.0 : beta * c_row[j * csc];
+        }
+    }
+}
+
+void SmallGemm(std::size_t m, std::size_t n, std::size_t k, double alpha, const double* a, std::size_t rsa,
+               std::size_t csa, const double* b, std::size_t rsb, std::size_t csb, double beta, double* c,
+               std::size_t rsc, std::size_t csc) {
+    ScaleC(m, n, beta, c, rsc, csc);
+    for (std::size_t i = 0; i < m; ++i) {
+        double* c_row = c + i * rsc;
+        for (std::size_t p = 0; p < k; ++p) {
+            const double a_ip = alpha * a[i * rsa + p * csa];
+            const double* b_row = b + p * rsb;
+            if ((csb == 1) && (csc == 1)) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    c_row[j] += a_ip * b_row[j];
+                }
+            } else {
+                for (std::size_t j = 0; j < n; ++j) {
+                    c_row[j * csc] += a_ip * b_row[j * csb];
+                }
+            }
+        }
+    }
+}
+
+/// Packs an mc x kc block of A into row panels of height kMR, stored column by column. Edges are zero padded.
+void PackA(std::size_t mc, std::size_t kc, const double* a, std::size_t rsa, std::size_t csa, double* packed) {
+    for (std::size_t i = 0; i < mc; i += kMR) {
+        const std::size_t mr = std::min(kMR, mc - i);
+        for (std::size_t p = 0; p < kc; ++p) {
+            const double* a_col = a + i * rsa + p * csa;
+            for (std::size_t ii = 0; ii < mr; ++ii) {
+                packed[ii] = a_col[ii * rsa];
+            }
+            std::fill(packed + mr, packed + kMR, 0.0);
+            packed += kMR;
+        }
+    }
+}
+
+/// Packs a kc x nc block of B into column panels of width kNR, stored row by row. Edges are zero padded.
+void PackB(std::size_t kc, std::size_t nc, const double* b, std::size_t rsb, std::size_t csb, double* packed) {
+    for (std::size_t j = 0; j < nc; j += kNR) {
+        const std::size_t nr = std::min(kNR, nc - j);
+        for (std::size_t p = 0; p < kc; ++p) {
+            const double* b_row = b + p * rsb + j * csb;
+            if (csb == 1) {
+                std::copy(b_row, b_row + nr, packed);
+            } else {
+                for (std::size_t jj = 0; jj < nr; ++jj) {
+                    packed[jj] = b_row[jj * csb];
+                }
+            }
+            std::fill(packed + nr, packed + kNR, 0.0);
+            packed += kNR;
+        }
+    }
+}
+
+/// Multiplies a packed kMR x kc panel of A by a packed kc x kNR panel of B and merges the mr x nr valid part of the
+/// result into C.
+void MicroKernel(std::size_t kc, double alpha, const double* a, const double* b, double beta, double* c,
+                 std::size_t rsc, std::size_t csc, std::size_t mr, std::size_t nr) {
+    static_assert((kMR == 4) && (kNR == 8), "micro tile must match simd::GemmTile4x8");
+    Tile acc{};
+    simd::GemmTile4x8(kc, a, b, acc.data());
+
+    for (std::size_t i = 0; i < mr; ++i) {
+        double* c_row = c + i * rsc;
+        for (std::size_t j = 0; j < nr; ++j) {
+            double& dst = c_row[j * csc];
+            dst = ((beta == 0.0) ? 0.0 : beta * dst) + alpha * acc[i * kNR + j];
+        }
+    }
+}
+
+void MacroKernel(std::size_t mc, std::size_t nc, std::size_t kc, double alpha, const double* packed_a,
+                 const double* packed_b, double beta, double* c, std::size_t rsc, std::size_t csc) {
+    for (std::size_t jr = 0; jr < nc; jr += kNR) {
+        for (std::size_t ir = 0; ir < mc; ir += kMR) {
+            MicroKernel(kc, alpha, packed_a + ir * kc, packed_b + jr * kc, beta, c + ir * rsc + jr * csc, rsc, csc,
+                        std::min(kMR, mc - ir), std::min(kNR, nc - jr));
+        }
+    }
+}
+
+std::size_t RoundUp(std::size_t value, std::size_t multiple) { return (value + multiple - 1) / multiple * multiple; }
+}  // namespace
+
+void Gemm(std::size_t m, std::size_t n, std::size_t k, double alpha, const double* a, std::size_t lda, const double* b,
+          std::size_t ldb, double beta, double* c, std::size_t ldc) {
+    Gemm(m, n, k, alpha, a, lda, 1, b, ldb, 1, beta, c, ldc, 1);
+}
+
+void Gemm(std::size_t m, std::size_t n, std::size_t k, double alpha, const double* a, std::size_t a_row_stride,
+          std::size_t a_col_stride, const double* b, std::size_t b_row_stride, std::size_t b_col_stride, double beta,
+          double* c, std::size_t c_row_stride, std::size_t c_col_stride) {
+    const std::size_t rsa = a_row_stride, csa = a_col_stride;
+    const std::size_t rsb = b_row_stride, csb = b_col_stride;
+    const std::size_t rsc = c_row_stride, csc = c_col_stride;
+
+    if ((m == 0) || (n == 0)) {
+        return;
+    }
+    if ((k == 0) || (alpha == 0.0)) {
+        ScaleC(m, n, beta, c, rsc, csc);
+        return;
+    }
+    if (m * n * k <= kSmallWork) {
+        SmallGemm(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, rsc, csc);
+        return;
+    }
+
+    // From the current allocator, so a Workspace serves it in repeated solves.
+    memory::Vector<double> packed_b(RoundUp(std::min(kNC, n), kNR) * kKC);
+
+    const std::size_t m_blocks = (m + kMC - 1) / kMC;
+    const std::size_t workers = parallel::ThreadPool::GetInstance().WorkerCount();
+
+    for (std::size_t jc = 0; jc < n; jc += kNC) {
+        const std::size_t nc = std::min(kNC, n - jc);
+        const std::size_t n_panels = (nc + kNR - 1) / kNR;
+        // When there are fewer row blocks than threads, the columns of C are split as well.
+        const std::size_t n_splits = std::min(n_panels, std::max<std::size_t>(1, 2 * workers / m_blocks));
+
+        for (std::size_t pc = 0; pc < k; pc += kKC) {
+            const std::size_t kc = std::min(kKC, k - pc);
+            // C is scaled by beta only once, while the first slice of k is accumulated.
+            const double beta_block = (pc == 0) ? beta : 1.0;
+
+            const double* b_block = b + pc * rsb + jc * csb;
+            double* packed = packed_b.data();
+            parallel::ParallelFor(0, n_panels, kc * kNR, [&](std::size_t first, std::size_t last) {
+                const std::size_t nc_first = first * kNR;
+                const std::size_t nc_last = std::min(nc, last * kNR);
+                PackB(kc, nc_last - nc_first, b_block + nc_first * csb, rsb, csb, packed + nc_first * kc);
+            });
+
+            // Every task packs its own block of A and updates a disjoint tile of C.
+            parallel::ParallelFor(0, m_blocks * n_splits, kMC * kc * nc / n_splits, [&](std::size_t first,
+                                                                                          std::size_t last) {
+                thread_local std::vector<double> packed_a{};
+                packed_a.resize(RoundUp(kMC, kMR) * kKC);
+
+                for (std::size_t task = first; task < last; ++task) {
+                    const std::size_t ic = (task / n_splits) * kMC;
+                    const std::size_t split = task % n_splits;
+                    const std::size_t mc = std::min(kMC, m - ic);
+                    const std::size_t jr_first = n_panels * split / n_splits * kNR;
+                    const std::size_t jr_last = std::min(nc, n_panels * (split + 1) / n_splits * kNR);
+
+                    PackA(mc, kc, a + ic * rsa + pc * csa, rsa, csa, packed_a.data());
+                    MacroKernel(mc, jr_last - jr_first, kc, alpha, packed_a.data(), packed + jr_first * kc,
+                                beta_block, c + ic * rsc + (jc + jr_first) * csc, rsc, csc);
+                }
+            });
+        }
+    }
+}
+
+void GemmNaive(std::size_t m, std::size_t n, std::size_t k, double alpha, const double* a, std::size_t lda,
+               const double* b, std::size_t ldb, double beta, double* c, std::size_t ldc) {
+    for (std::size_t r = 0; r < m; ++r) {
+        for (std::size_t col = 0; col < n; ++col) {
+            double sum = 0.0;
+            for (std::size_t i = 0; i < k; ++i) {
+                sum += a[r * lda + i] * b[i * ldb + col];
+            }
+            double& dst = c[r * ldc + col];
+            dst = ((beta == 0.0) ? 0.0 : beta * dst) + alpha * sum;
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace matrix
+}  // namespace math_cpp
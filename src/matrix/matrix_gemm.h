@@ -0,0 +1,41 @@
+/// @file matrix_gemm.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief General matrix-matrix multiplication kernels.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_GEMM_H_
+#define SRC_MATRIX_MATRIX_GEMM_H_
+
+#include <cstddef>
+
+namespace math_cpp {
+namespace matrix {
+namespace kernel {
+
+/// @brief Computes C = alpha * A * B + beta * C on row-major buffers.
+/// A is m x k with leading dimension lda, B is k x n with leading dimension ldb and C is m x n with leading dimension
+/// ldc. Operands are packed into cache sized blocks and multiplied by a register tiled micro-kernel. When beta is 0, C
+/// is not read.
+void Gemm(std::size_t m, std::size_t n, std::size_t k, double alpha, const double* a, std::size_t lda, const double* b,
+          std::size_t ldb, double beta, double* c, std::size_t ldc);
+
+/// @brief Gemm on strided operands. Element (i, j) of A is a[i * a_row_stride + j * a_col_stride], likewise for B and
+/// C, so transposed operands and column blocks can be multiplied without copies.
+void Gemm(std::size_t m, std::size_t n, std::size_t k, double alpha, const double* a, std::size_t a_row_stride,
+          std::size_t a_col_stride, const double* b, std::size_t b_row_stride, std::size_t b_col_stride, double beta,
+          double* c, std::size_t c_row_stride, std::size_t c_col_stride);
+
+/// @brief Reference triple loop implementation of Gemm. Same contract, no blocking. Kept for testing.
+void GemmNaive(std::size_t m, std::size_t n, std::size_t k, double alpha, const double* a, std::size_t lda,
+               const double* b, std::size_t ldb, double beta, double* c, std::size_t ldc);
+
+}  // namespace kernel
+}  // namespace matrix
+}  // namespace math_cpp
+
+#endif  // SRC_MATRIX_MATRIX_GEMM_H_
@@ -0,0 +1,348 @@
+/// @file matrix_kernel.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_kernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "src/matrix/matrix_gemm.h"
+#include "src/matrix/matrix_simd.h"
+#include "src/memory/allocator.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+namespace kernel {
+
+namespace {
+void CheckSameSize(const ConstMatrixView& lhs, const ConstMatrixView& rhs) {
+    if (!lhs.IsSameSize(rhs)) {
+        throw std::invalid_argument("views must be same size!");
+    }
+}
+
+/// Views with a single row can also be walked contiguously along their columns and vice versa. Treat a column vector
+/// as a row vector so both take the simd path.
+ConstMatrixView AsRows(const ConstMatrixView& view) { return (view.Col() == 1) ? view.Transpose() : view; }
+MatrixView AsRows(const MatrixView& view) { return (view.Col() == 1) ? view.Transpose() : view; }
+
+// Transposes walk tiles of kTransposeTile x kTransposeTile, small enough that the rows read and the rows written both
+// stay in L1. Tiles are made of 4 x 4 in-register transposes.
+constexpr std::size_t kTransposeTile = 32;
+constexpr std::size_t kMicro = 4;
+
+// Rows summed by one task of MultiplyTransposed, the partial sums are added in a fixed order.
+constexpr std::size_t kChunkRows = 1024;
+
+std::size_t TileCount(std::size_t size) { return (size + kTransposeTile - 1) / kTransposeTile; }
+
+/// dst = src^T for rows [r0, r1) and columns [c0, c1) of src. Both views are row contiguous.
+void TransposeTile(const ConstMatrixView& src, const MatrixView& dst, std::size_t r0, std::size_t r1, std::size_t c0,
+                   std::size_t c1) {
+    std::size_t r = r0;
+    for (; r + kMicro <= r1; r += kMicro) {
+        std::size_t c = c0;
+        for (; c + kMicro <= c1; c += kMicro) {
+            simd::Transpose4x4(src.RowData(r) + c, src.RowStride(), dst.RowData(c) + r, dst.RowStride());
+        }
+        for (; c < c1; ++c) {
+            for (std::size_t i = r; i < r + kMicro; ++i) {
+                dst.AtUnchecked(c, i) = src.AtUnchecked(i, c);
+            }
+        }
+    }
+    for (; r < r1; ++r) {
+        for (std::size_t c = c0; c < c1; ++c) {
+            dst.AtUnchecked(c, r) = src.AtUnchecked(r, c);
+        }
+    }
+}
+
+double SumSquares(const ConstMatrixView& x) {
+    const ConstMatrixView src = AsRows(x);
+    double sum = 0.0;
+    for (std::size_t r = 0; r < src.Row(); ++r) {
+        if (src.IsRowContiguous()) {
+            sum += simd::SumSquares(src.RowData(r), src.Col());
+        } else {
+            for (std::size_t c = 0; c < src.Col(); ++c) {
+                sum += src.AtUnchecked(r, c) * src.AtUnchecked(r, c);
+            }
+        }
+    }
+    return sum;
+}
+
+/// sum += x(r) * a(r, :) for the rows first .. last of a.
+void AccumulateRows(const ConstMatrixView& a, const ConstMatrixView& x, std::size_t first, std::size_t last,
+                    double* sum) {
+    for (std::size_t r = first; r < last; ++r) {
+        const double scale = x.AtUnchecked(r, 0);
+        if (a.IsRowContiguous()) {
+            simd::Axpy(scale, a.RowData(r), sum, a.Col());
+        } else {
+            for (std::size_t c = 0; c < a.Col(); ++c) {
+                sum[c] += scale * a.AtUnchecked(r, c);
+            }
+        }
+    }
+}
+
+/// Swaps the 4 x 4 blocks at (r, c) and (c, r) of x transposed, the diagonal block when r == c.
+void SwapTransposedBlocks(const MatrixView& x, std::size_t r, std::size_t c) {
+    double block[kMicro * kMicro];
+    simd::Transpose4x4(x.RowData(r) + c, x.RowStride(), block, kMicro);
+    if (r != c) {
+        simd::Transpose4x4(x.RowData(c) + r, x.RowStride(), x.RowData(r) + c, x.RowStride());
+    }
+    for (std::size_t i = 0; i < kMicro; ++i) {
+        std::copy(block + i * kMicro, block + (i + 1) * kMicro, x.RowData(c + i) + r);
+    }
+}
+}  // namespace
+
+void Gemm(double alpha, const ConstMatrixView& a, const ConstMatrixView& b, double beta, const MatrixView& c) {
+    if ((a.Col() != b.Row()) || (a.Row() != c.Row()) || (b.Col() != c.Col())) {
+        throw std::invalid_argument("cannot matrix multiply, check size!");
+    }
+    Gemm(c.Row(), c.Col(), a.Col(), alpha, a.Data(), a.RowStride(), a.ColStride(), b.Data(), b.RowStride(),
+         b.ColStride(), beta, c.Data(), c.RowStride(), c.ColStride());
+}
+
+void Axpy(double alpha, const ConstMatrixView& x, const MatrixView& y) {
+    CheckSameSize(x, y);
+    const ConstMatrixView src = AsRows(x);
+    const MatrixView dst = AsRows(y);
+    for (std::size_t r = 0; r < dst.Row(); ++r) {
+        if (src.IsRowContiguous() && dst.IsRowContiguous()) {
+            simd::Axpy(alpha, src.RowData(r), dst.RowData(r), dst.Col());
+        } else {
+            for (std::size_t c = 0; c < dst.Col(); ++c) {
+                dst.AtUnchecked(r, c) += alpha * src.AtUnchecked(r, c);
+            }
+        }
+    }
+}
+
+void Scale(double alpha, const MatrixView& x) {
+    const MatrixView dst = AsRows(x);
+    for (std::size_t r = 0; r < dst.Row(); ++r) {
+        if (dst.IsRowContiguous()) {
+            simd::Scale(alpha, dst.RowData(r), dst.RowData(r), dst.Col());
+        } else {
+            for (std::size_t c = 0; c < dst.Col(); ++c) {
+                dst.AtUnchecked(r, c) *= alpha;
+            }
+        }
+    }
+}
+
+void Copy(const ConstMatrixView& src, const MatrixView& dst) {
+    CheckSameSize(src, dst);
+    const ConstMatrixView from = AsRows(src);
+    const MatrixView to = AsRows(dst);
+    for (std::size_t r = 0; r < to.Row(); ++r) {
+        if (from.IsRowContiguous() && to.IsRowContiguous()) {
+            std::copy(from.RowData(r), from.RowData(r) + to.Col(), to.RowData(r));
+        } else {
+            for (std::size_t c = 0; c < to.Col(); ++c) {
+                to.AtUnchecked(r, c) = from.AtUnchecked(r, c);
+            }
+        }
+    }
+}
+
+double Dot(const ConstMatrixView& x, const ConstMatrixView& y) {
+    CheckSameSize(x, y);
+    const ConstMatrixView lhs = AsRows(x);
+    const ConstMatrixView rhs = AsRows(y);
+    double sum = 0.0;
+    for (std::size_t r = 0; r < lhs.Row(); ++r) {
+        if (lhs.IsRowContiguous() && rhs.IsRowContiguous()) {
+            sum += simd::Dot(lhs.RowData(r), rhs.RowData(r), lhs.Col());
+        } else {
+            for (std::size_t c = 0; c < lhs.Col(); ++c) {
+                sum += lhs.AtUnchecked(r, c) * rhs.AtUnchecked(r, c);
+            }
+        }
+    }
+    return sum;
+}
+
+double Norm2(const ConstMatrixView& x) { return std::sqrt(SumSquares(x)); }
+
+double MakeReflector(const MatrixView& x, double& tau) {
+    const MatrixView v = AsRows(x);
+    if ((v.Row() != 1) || (v.Col() == 0)) {
+        throw std::invalid_argument("check size, x should be a non-empty vector");
+    }
+    const std::size_t size = v.Col();
+    const double alpha = v.AtUnchecked(0, 0);
+    const double sigma = (size > 1) ? SumSquares(v.Block(0, 1, 1, size - 1)) : 0.0;
+    v.AtUnchecked(0, 0) = 1.0;
+    if (sigma == 0.0) {
+        tau = 0.0;
+        return alpha;
+    }
+    const double norm = std::sqrt(alpha * alpha + sigma);
+    const double beta = (alpha >= 0.0) ? -norm : norm;
+    tau = (beta - alpha) / beta;
+    Scale(1.0 / (alpha - beta), v.Block(0, 1, 1, size - 1));
+    return beta;
+}
+
+void MultiplyTransposed(const ConstMatrixView& a, const ConstMatrixView& x, const MatrixView& y) {
+    const std::size_t rows = a.Row();
+    const std::size_t cols = a.Col();
+    if ((x.Row() != rows) || (x.Col() != 1) || (y.Row() != cols) || (y.Col() != 1)) {
+        throw std::invalid_argument("check size, x should be a.Row() x 1 and y a.Col() x 1");
+    }
+    const MatrixView out = y.Transpose();
+    const std::size_t chunks = (rows + kChunkRows - 1) / kChunkRows;
+    if ((chunks <= 1) && out.IsRowContiguous()) {
+        std::fill(out.RowData(0), out.RowData(0) + cols, 0.0);
+        AccumulateRows(a, x, 0, rows, out.RowData(0));
+        return;
+    }
+    memory::Vector<double> partial(std::max<std::size_t>(chunks, 1) * cols);
+    parallel::ParallelFor(0, chunks, kChunkRows * cols, [&](std::size_t first, std::size_t last) {
+        for (std::size_t chunk = first; chunk < last; ++chunk) {
+            AccumulateRows(a, x, chunk * kChunkRows, std::min(rows, (chunk + 1) * kChunkRows),
+                           partial.data() + chunk * cols);
+        }
+    });
+    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+        simd::Axpy(1.0, partial.data() + chunk * cols, partial.data(), cols);
+    }
+    Copy(ConstMatrixView(partial.data(), 1, cols, cols, 1), out);
+}
+
+void HouseholderBlockFactor(const ConstMatrixView& v, const double* tau, const MatrixView& t) {
+    const std::size_t k = v.Col();
+    if ((t.Row() != k) || (t.Col() != k)) {
+        throw std::invalid_argument("check size, t should be k x k for k reflectors");
+    }
+    // T(0..i, i) = -tau(i) * T(0..i, 0..i) * V(:, 0..i)^T * v(i), the Gram matrix V^T * V is one GEMM for all i.
+    memory::Vector<double> gram_data(k * k);
+    const MatrixView gram(gram_data.data(), k, k, k, 1);
+    Gemm(1.0, v.Transpose(), v, 0.0, gram);
+
+    for (std::size_t i = 0; i < k; ++i) {
+        for (std::size_t r = i + 1; r < k; ++r) {
+            t.AtUnchecked(r, i) = 0.0;
+        }
+        t.AtUnchecked(i, i) = tau[i];
+        for (std::size_t r = 0; r < i; ++r) {
+            double sum = 0.0;
+            for (std::size_t l = r; l < i; ++l) {
+                sum += t.AtUnchecked(r, l) * gram.AtUnchecked(l, i);
+            }
+            t.AtUnchecked(r, i) = -tau[i] * sum;
+        }
+    }
+}
+
+void ApplyBlockReflector(const ConstMatrixView& v, const ConstMatrixView& t, bool transpose, const MatrixView& b) {
+    const std::size_t k = v.Col();
+    if ((v.Row() != b.Row()) || (t.Row() != k) || (t.Col() != k)) {
+        throw std::invalid_argument("check size, v should be m x k and t k x k for an m row b");
+    }
+    memory::Vector<double> w_data(k * b.Col());
+    memory::Vector<double> tw_data(k * b.Col());
+    const MatrixView w(w_data.data(), k, b.Col(), b.Col(), 1);
+    const MatrixView tw(tw_data.data(), k, b.Col(), b.Col(), 1);
+    Gemm(1.0, v.Transpose(), b, 0.0, w);
+    Gemm(1.0, transpose ? t.Transpose() : t, w, 0.0, tw);
+    Gemm(-1.0, v, tw, 1.0, b);
+}
+
+void ApplyBlockReflector(const ConstMatrixView& head, const ConstMatrixView& tail, const ConstMatrixView& t,
+                         bool transpose, const MatrixView& b) {
+    const std::size_t k = head.Col();
+    if ((head.Row() != k) || (tail.Col() != k) || (head.Row() + tail.Row() != b.Row()) || (t.Row() != k) ||
+        (t.Col() != k)) {
+        throw std::invalid_argument("check size, head should be k x k, tail (m - k) x k and t k x k for an m row b");
+    }
+    const MatrixView top = b.Block(0, 0, k, b.Col());
+    const MatrixView bottom = b.Block(k, 0, tail.Row(), b.Col());
+    memory::Vector<double> w_data(k * b.Col());
+    memory::Vector<double> tw_data(k * b.Col());
+    const MatrixView w(w_data.data(), k, b.Col(), b.Col(), 1);
+    const MatrixView tw(tw_data.data(), k, b.Col(), b.Col(), 1);
+    Gemm(1.0, head.Transpose(), top, 0.0, w);
+    Gemm(1.0, tail.Transpose(), bottom, 1.0, w);
+    Gemm(1.0, transpose ? t.Transpose() : t, w, 0.0, tw);
+    Gemm(-1.0, head, tw, 1.0, top);
+    Gemm(-1.0, tail, tw, 1.0, bottom);
+}
+
+void Transpose(const ConstMatrixView& src, const MatrixView& dst) {
+    CheckSameSize(src.Transpose(), dst);
+    if (!src.IsRowContiguous() || !dst.IsRowContiguous()) {
+        Copy(src.Transpose(), dst);
+        return;
+    }
+    const std::size_t rows = src.Row();
+    const std::size_t cols = src.Col();
+    parallel::ParallelFor(0, TileCount(rows), kTransposeTile * cols, [&](std::size_t first, std::size_t last) {
+        for (std::size_t tile = first; tile < last; ++tile) {
+            const std::size_t r0 = tile * kTransposeTile;
+            const std::size_t r1 = std::min(r0 + kTransposeTile, rows);
+            for (std::size_t c0 = 0; c0 < cols; c0 += kTransposeTile) {
+                TransposeTile(src, dst, r0, r1, c0, std::min(c0 + kTransposeTile, cols));
+            }
+        }
+    });
+}
+
+void TransposeInPlace(const MatrixView& x) {
+    if (x.Row() != x.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+    const std::size_t n = x.Row();
+    if (!x.IsRowContiguous()) {
+        for (std::size_t r = 0; r < n; ++r) {
+            for (std::size_t c = r + 1; c < n; ++c) {
+                std::swap(x.AtUnchecked(r, c), x.AtUnchecked(c, r));
+            }
+        }
+        return;
+    }
+
+    // Tile row i swaps its tiles right of the diagonal with tile column i, so tile rows are independent.
+    const std::size_t blocked = n - n % kMicro;
+    parallel::ParallelFor(0, TileCount(n), kTransposeTile * n, [&](std::size_t first, std::size_t last) {
+        for (std::size_t tile = first; tile < last; ++tile) {
+            const std::size_t r0 = tile * kTransposeTile;
+            const std::size_t r1 = std::min(r0 + kTransposeTile, blocked);
+            for (std::size_t c0 = r0; c0 < blocked; c0 += kTransposeTile) {
+                const std::size_t c1 = std::min(c0 + kTransposeTile, blocked);
+                for (std::size_t r = r0; r < r1; r += kMicro) {
+                    for (std::size_t c = std::max(c0, r); c < c1; c += kMicro) {
+                        SwapTransposedBlocks(x, r, c);
+                    }
+                }
+            }
+            // The last n % 4 columns, against the matching rows.
+            for (std::size_t r = r0; r < std::min(r0 + kTransposeTile, n); ++r) {
+                for (std::size_t c = std::max(blocked, r + 1); c < n; ++c) {
+                    std::swap(x.AtUnchecked(r, c), x.AtUnchecked(c, r));
+                }
+            }
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace matrix
+}  // namespace math_cpp
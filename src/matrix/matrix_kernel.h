@@ -0,0 +1,71 @@
+/// @file matrix_kernel.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief BLAS-like kernels on matrix views.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_KERNEL_H_
+#define SRC_MATRIX_MATRIX_KERNEL_H_
+
+#include "src/matrix/matrix_view.h"
+
+namespace math_cpp {
+namespace matrix {
+namespace kernel {
+
+/// @brief c = alpha * a * b + beta * c. Any view works, e.g. a.Transpose() multiplies by the transpose without copying.
+void Gemm(double alpha, const ConstMatrixView& a, const ConstMatrixView& b, double beta, const MatrixView& c);
+
+/// @brief y += alpha * x, x and y have the same shape.
+void Axpy(double alpha, const ConstMatrixView& x, const MatrixView& y);
+
+/// @brief x *= alpha
+void Scale(double alpha, const MatrixView& x);
+
+/// @brief dst = src, both have the same shape.
+void Copy(const ConstMatrixView& src, const MatrixView& dst);
+
+/// @brief dst = src^T. Row contiguous views go through cache-sized tiles of 4 x 4 in-register transposes.
+void Transpose(const ConstMatrixView& src, const MatrixView& dst);
+
+/// @brief x = x^T for a square view, without extra memory.
+void TransposeInPlace(const MatrixView& x);
+
+/// @brief Sum of the elementwise products of two views of the same shape.
+double Dot(const ConstMatrixView& x, const ConstMatrixView& y);
+
+/// @brief Frobenius norm.
+double Norm2(const ConstMatrixView& x);
+
+/// @brief Householder reflector with (I - tau * v * v^T) * x = (beta, 0, ..., 0) for a row or column vector x, which is
+/// overwritten by v with v(0) = 1. Returns beta, whose sign is opposite to x(0) so that x(0) - beta never cancels.
+double MakeReflector(const MatrixView& x, double& tau);
+
+/// @brief y = a^T * x for an a.Row() x 1 column x and an a.Col() x 1 column y. a is walked row by row so every access
+/// is contiguous. Chunks of rows are summed in parallel and then added in order, the result does not depend on the
+/// thread count.
+void MultiplyTransposed(const ConstMatrixView& a, const ConstMatrixView& x, const MatrixView& y);
+
+/// @brief t = T of the compact WY form I - V * T * V^T = H(0) * H(1) * ... * H(k - 1), H(i) = I - tau[i] * v_i * v_i^T.
+/// v is m x k with the reflectors as columns, unit lower trapezoidal with explicit ones and zeros. t is k x k upper
+/// triangular.
+void HouseholderBlockFactor(const ConstMatrixView& v, const double* tau, const MatrixView& t);
+
+/// @brief b = (I - V * T * V^T) * b, or with T^T when transpose is set, the product of the reflectors in reverse
+/// order. Three GEMMs with k columns.
+void ApplyBlockReflector(const ConstMatrixView& v, const ConstMatrixView& t, bool transpose, const MatrixView& b);
+
+/// @brief Same as above with V given as its top k rows head and the rows below tail, so V can be read in place from a
+/// factorization that keeps R above the diagonal: only the small head needs explicit ones and zeros. Five GEMMs.
+void ApplyBlockReflector(const ConstMatrixView& head, const ConstMatrixView& tail, const ConstMatrixView& t,
+                         bool transpose, const MatrixView& b);
+
+}  // namespace kernel
+}  // namespace matrix
+}  // namespace math_cpp
+
+#endif  // SRC_MATRIX_MATRIX_KERNEL_H_
@@ -0,0 +1,320 @@
+/// @file matrix_krylov_solver.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_krylov_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "src/matrix/matrix_kernel.h"
+
+namespace math_cpp {
+namespace matrix {
+
+KrylovSolver::KrylovSolver(Method method, const LinearOperator& op, std::size_t size,
+                           const Preconditioner& preconditioner, double tolerance, std::size_t max_iterations)
+    : method_(method),
+      op_(op),
+      size_(size),
+      preconditioner_(preconditioner),
+      tolerance_(tolerance),
+      max_iterations_(max_iterations) {}
+
+KrylovSolver::KrylovSolver(Method method, const Matrix& mat, const Preconditioner& preconditioner, double tolerance,
+                           std::size_t max_iterations)
+    : KrylovSolver(method, MakeLinearOperator(mat), mat.Row(), preconditioner, tolerance, max_iterations) {
+    if (mat.Row() != mat.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+}
+
+KrylovSolver::KrylovSolver(Method method, const SparseMatrix& mat, const Preconditioner& preconditioner,
+                           double tolerance, std::size_t max_iterations)
+    : KrylovSolver(method, MakeLinearOperator(mat), mat.Row(), preconditioner, tolerance, max_iterations) {
+    if (mat.Row() != mat.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+}
+
+void KrylovSolver::SetRestart(std::size_t restart) {
+    if (restart == 0) {
+        throw std::invalid_argument("restart should be positive");
+    }
+    restart_ = restart;
+}
+
+Matrix KrylovSolver::Solve(const Matrix& b) { return Solve(b, Matrix(size_, 1)); }
+
+Matrix KrylovSolver::Solve(const Matrix& b, const Matrix& x0) {
+    if ((b.Row() != size_) || (b.Col() != 1) || (x0.Row() != size_) || (x0.Col() != 1)) {
+        throw std::invalid_argument("check size, b and x0 should be n x 1");
+    }
+    converged_ = false;
+    iterations_ = 0;
+    operator_calls_ = 0;
+    residual_history_.clear();
+
+    const double b_norm = kernel::Norm2(b);
+    if (b_norm == 0.0) {
+        // x = 0 is exact, any other guess could only be worse.
+        converged_ = true;
+        residual_history_.push_back(0.0);
+        return Matrix(size_, 1);
+    }
+
+    Matrix x = x0;
+    switch (method_) {
+        case Method::kCG:
+            SolveCG(b, x, b_norm);
+            break;
+        case Method::kBiCGSTAB:
+            SolveBiCGSTAB(b, x, b_norm);
+            break;
+        case Method::kGMRES:
+            SolveGMRES(b, x, b_norm);
+            break;
+    }
+    return x;
+}
+
+bool KrylovSolver::IsConverged() const { return converged_; }
+
+std::size_t KrylovSolver::Iterations() const { return iterations_; }
+
+std::size_t KrylovSolver::OperatorCalls() const { return operator_calls_; }
+
+const std::vector<double>& KrylovSolver::ResidualHistory() const { return residual_history_; }
+
+double KrylovSolver::RelativeResidual() const {
+    return residual_history_.empty() ? 0.0 : residual_history_.back();
+}
+
+void KrylovSolver::Apply(const ConstMatrixView& x, const MatrixView& y) {
+    op_(x, y);
+    ++operator_calls_;
+}
+
+void KrylovSolver::Precondition(const ConstMatrixView& r, const MatrixView& z) const {
+    if (preconditioner_) {
+        preconditioner_(r, z);
+    } else {
+        kernel::Copy(r, z);
+    }
+}
+
+bool KrylovSolver::Record(double residual_norm, double b_norm) {
+    residual_history_.push_back(residual_norm / b_norm);
+    converged_ = (residual_history_.back() <= tolerance_);
+    return converged_;
+}
+
+void KrylovSolver::SolveCG(const Matrix& b, Matrix& x, double b_norm) {
+    Matrix r(size_, 1);
+    Matrix z(size_, 1);
+    Matrix p(size_, 1);
+    Matrix product(size_, 1);
+
+    Apply(x, product);
+    kernel::Copy(b, r);
+    kernel::Axpy(-1.0, product, r);
+    if (Record(kernel::Norm2(r), b_norm)) {
+        return;
+    }
+
+    Precondition(r, z);
+    kernel::Copy(z, p);
+    double rz = kernel::Dot(r, z);
+    while (iterations_ < max_iterations_) {
+        Apply(p, product);
+        const double curvature = kernel::Dot(p, product);
+        if (!(curvature > 0.0)) {
+            // A is not positive definite along p, CG cannot continue.
+            break;
+        }
+        const double alpha = rz / curvature;
+        kernel::Axpy(alpha, p, x);
+        kernel::Axpy(-alpha, product, r);
+        ++iterations_;
+        if (Record(kernel::Norm2(r), b_norm)) {
+            return;
+        }
+
+        Precondition(r, z);
+        const double rz_next = kernel::Dot(r, z);
+        const double beta = rz_next / rz;
+        rz = rz_next;
+        // p = z + beta * p
+        kernel::Scale(beta, p);
+        kernel::Axpy(1.0, z, p);
+    }
+}
+
+void KrylovSolver::SolveBiCGSTAB(const Matrix& b, Matrix& x, double b_norm) {
+    Matrix r(size_, 1);
+    Matrix p(size_, 1);
+    Matrix v(size_, 1);
+    Matrix s(size_, 1);
+    Matrix t(size_, 1);
+    Matrix p_hat(size_, 1);
+    Matrix s_hat(size_, 1);
+
+    Apply(x, v);
+    kernel::Copy(b, r);
+    kernel::Axpy(-1.0, v, r);
+    if (Record(kernel::Norm2(r), b_norm)) {
+        return;
+    }
+
+    // Shadow residual, fixed for the whole solve.
+    const Matrix r_hat = r;
+    double rho = 1.0;
+    double alpha = 1.0;
+    double omega = 1.0;
+    while (iterations_ < max_iterations_) {
+        const double rho_next = kernel::Dot(r_hat, r);
+        if (rho_next == 0.0) {
+            break;
+        }
+        if (iterations_ == 0) {
+            kernel::Copy(r, p);
+        } else {
+            // p = r + beta * (p - omega * v)
+            const double beta = (rho_next / rho) * (alpha / omega);
+            kernel::Axpy(-omega, v, p);
+            kernel::Scale(beta, p);
+            kernel::Axpy(1.0, r, p);
+        }
+        rho = rho_next;
+
+        Precondition(p, p_hat);
+        Apply(p_hat, v);
+        const double projection = kernel::Dot(r_hat, v);
+        if (projection == 0.0) {
+            break;
+        }
+        alpha = rho / projection;
+        kernel::Copy(r, s);
+        kernel::Axpy(-alpha, v, s);
+        ++iterations_;
+
+        // Half step, s is the residual of x + alpha * p_hat.
+        const double s_norm = kernel::Norm2(s);
+        if (s_norm <= tolerance_ * b_norm) {
+            kernel::Axpy(alpha, p_hat, x);
+            Record(s_norm, b_norm);
+            return;
+        }
+
+        Precondition(s, s_hat);
+        Apply(s_hat, t);
+        const double t_norm2 = kernel::Dot(t, t);
+        omega = (t_norm2 > 0.0) ? kernel::Dot(t, s) / t_norm2 : 0.0;
+        kernel::Axpy(alpha, p_hat, x);
+        kernel::Axpy(omega, s_hat, x);
+        kernel::Copy(s, r);
+        kernel::Axpy(-omega, t, r);
+        if (Record(kernel::Norm2(r), b_norm) || (omega == 0.0)) {
+            return;
+        }
+    }
+}
+
+void KrylovSolver::SolveGMRES(const Matrix& b, Matrix& x, double b_norm) {
+    const std::size_t m = std::min(restart_, size_);
+    // Row j is Krylov vector j, basis.RowView(j).Transpose() is its n x 1 view.
+    Matrix basis(m + 1, size_);
+    // Upper Hessenberg matrix of the Arnoldi process, reduced to upper triangular by Givens rotations as it grows.
+    Matrix hessenberg(m + 1, m);
+    Matrix cosines(m, 1);
+    Matrix sines(m, 1);
+    Matrix g(m + 1, 1);
+    Matrix y(m, 1);
+    Matrix r(size_, 1);
+    Matrix w(size_, 1);
+    Matrix z(size_, 1);
+    auto krylov = [&basis](std::size_t j) { return basis.RowView(j).Transpose(); };
+
+    for (bool first = true;; first = false) {
+        Apply(x, w);
+        kernel::Copy(b, r);
+        kernel::Axpy(-1.0, w, r);
+        const double beta = kernel::Norm2(r);
+        if (!first) {
+            residual_history_.pop_back();
+        }
+        if (Record(beta, b_norm) || (iterations_ >= max_iterations_)) {
+            return;
+        }
+
+        kernel::Copy(r, krylov(0));
+        kernel::Scale(1.0 / beta, krylov(0));
+        kernel::Scale(0.0, g);
+        g(0, 0) = beta;
+
+        std::size_t k = 0;
+        while ((k < m) && (iterations_ < max_iterations_)) {
+            const std::size_t j = k;
+            Precondition(krylov(j), z);
+            Apply(z, w);
+
+            // Modified Gram-Schmidt against the basis so far.
+            for (std::size_t i = 0; i <= j; ++i) {
+                const double h = kernel::Dot(w, krylov(i));
+                hessenberg(i, j) = h;
+                kernel::Axpy(-h, krylov(i), w);
+            }
+            const double next_norm = kernel::Norm2(w);
+            hessenberg(j + 1, j) = next_norm;
+            if (next_norm > 0.0) {
+                kernel::Copy(w, krylov(j + 1));
+                kernel::Scale(1.0 / next_norm, krylov(j + 1));
+            }
+
+            for (std::size_t i = 0; i < j; ++i) {
+                const double upper = hessenberg(i, j);
+                const double lower = hessenberg(i + 1, j);
+                hessenberg(i, j) = cosines(i, 0) * upper + sines(i, 0) * lower;
+                hessenberg(i + 1, j) = -sines(i, 0) * upper + cosines(i, 0) * lower;
+            }
+            const double radius = std::hypot(hessenberg(j, j), next_norm);
+            cosines(j, 0) = (radius > 0.0) ? hessenberg(j, j) / radius : 1.0;
+            sines(j, 0) = (radius > 0.0) ? next_norm / radius : 0.0;
+            hessenberg(j, j) = radius;
+            hessenberg(j + 1, j) = 0.0;
+            g(j + 1, 0) = -sines(j, 0) * g(j, 0);
+            g(j, 0) = cosines(j, 0) * g(j, 0);
+
+            ++iterations_;
+            ++k;
+            // A zero next_norm means the Krylov space is invariant and x is exact after this update.
+            if (Record(std::abs(g(j + 1, 0)), b_norm) || (next_norm == 0.0)) {
+                break;
+            }
+        }
+
+        // Back substitution for the triangular least squares problem R * y = g.
+        for (std::size_t i = k; i-- > 0;) {
+            double sum = g(i, 0);
+            for (std::size_t l = i + 1; l < k; ++l) {
+                sum -= hessenberg(i, l) * y(l, 0);
+            }
+            y(i, 0) = (hessenberg(i, i) != 0.0) ? sum / hessenberg(i, i) : 0.0;
+        }
+
+        // x += M^-1 * V * y
+        kernel::Gemm(1.0, basis.Block(0, 0, k, size_).Transpose(), y.Block(0, 0, k, 1), 0.0, w);
+        Precondition(w, z);
+        kernel::Axpy(1.0, z, x);
+    }
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
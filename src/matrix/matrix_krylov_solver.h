@@ -0,0 +1,97 @@
+/// @file matrix_krylov_solver.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Iterative solvers for large linear systems.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_KRYLOV_SOLVER_H_
+#define SRC_MATRIX_MATRIX_KRYLOV_SOLVER_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_linear_operator.h"
+#include "src/matrix/matrix_preconditioner.h"
+#include "src/matrix/matrix_sparse.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Solves A * x = b with Krylov methods, touching A only through matrix-vector products. Memory is a few n x 1
+/// vectors (restart + 1 of them for GMRES) instead of the n x n factors of a direct solve.
+///  - kCG, conjugate gradient, A symmetric positive definite. The preconditioner must be symmetric positive definite.
+///  - kBiCGSTAB, stabilized bi-conjugate gradient, any non-singular A, two products per iteration.
+///  - kGMRES, restarted GMRES(restart), any non-singular A, minimizes the residual over every restart cycle.
+/// BiCGSTAB and GMRES are right-preconditioned, so every solver checks the true residual |b - A * x|, not M^-1 of it.
+class KrylovSolver {
+ public:
+    enum class Method {
+        kCG,
+        kBiCGSTAB,
+        kGMRES,
+    };
+
+    /// @param op y = A * x of an n x n operator.
+    /// @param size n
+    /// @param preconditioner z = M^-1 * r, empty for none.
+    /// @param tolerance Converged when |b - A * x| <= tolerance * |b|.
+    /// @param max_iterations Iterations allowed, counted over restarts. The last x is kept when they run out,
+    /// IsConverged tells whether it is good enough.
+    KrylovSolver(Method method, const LinearOperator& op, std::size_t size, const Preconditioner& preconditioner = {},
+                 double tolerance = 1e-10, std::size_t max_iterations = 1000);
+    /// @brief The matrix is referenced, not copied, and must outlive the solver.
+    KrylovSolver(Method method, const Matrix& mat, const Preconditioner& preconditioner = {}, double tolerance = 1e-10,
+                 std::size_t max_iterations = 1000);
+    KrylovSolver(Method method, const SparseMatrix& mat, const Preconditioner& preconditioner = {},
+                 double tolerance = 1e-10, std::size_t max_iterations = 1000);
+
+    /// @brief Krylov vectors kept by GMRES before it restarts, 30 by default. Ignored by the other methods.
+    void SetRestart(std::size_t restart);
+
+    /// @brief Solves from x = 0. b is n x 1.
+    Matrix Solve(const Matrix& b);
+    /// @brief Solves from the initial guess x0, e.g. the solution of a nearby system.
+    Matrix Solve(const Matrix& b, const Matrix& x0);
+
+    /// @brief Statistics of the last Solve.
+    bool IsConverged() const;
+    std::size_t Iterations() const;
+    std::size_t OperatorCalls() const;
+    /// @brief |b - A * x| / |b| of the initial guess followed by one entry per iteration. Within a cycle GMRES records
+    /// the residual of its least squares problem, the last entry of a cycle is replaced by the true residual.
+    const std::vector<double>& ResidualHistory() const;
+    /// @brief Last entry of ResidualHistory.
+    double RelativeResidual() const;
+
+ private:
+    void SolveCG(const Matrix& b, Matrix& x, double b_norm);
+    void SolveBiCGSTAB(const Matrix& b, Matrix& x, double b_norm);
+    void SolveGMRES(const Matrix& b, Matrix& x, double b_norm);
+
+    void Apply(const ConstMatrixView& x, const MatrixView& y);
+    void Precondition(const ConstMatrixView& r, const MatrixView& z) const;
+    /// Records |r| / |b| and returns whether it has converged.
+    bool Record(double residual_norm, double b_norm);
+
+    Method method_;
+    LinearOperator op_;
+    std::size_t size_;
+    Preconditioner preconditioner_;
+    double tolerance_;
+    std::size_t max_iterations_;
+    std::size_t restart_{30};
+
+    bool converged_{false};
+    std::size_t iterations_{};
+    std::size_t operator_calls_{};
+    std::vector<double> residual_history_{};
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_KRYLOV_SOLVER_H_
@@ -0,0 +1,201 @@
+/// @file matrix_lanczos_solver.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_lanczos_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "src/matrix/matrix_kernel.h"
+#include "src/matrix/matrix_symmetric_solver.h"
+
+namespace math_cpp {
+namespace matrix {
+
+namespace {
+// Extra basis vectors beyond k. More vectors cost memory and orthogonalization, fewer cost restarts.
+constexpr std::size_t kExtraVectors = 20;
+// A new direction shorter than this, relative to |A * v|, means the Krylov space is invariant.
+constexpr double kBreakdown = 1e-12;
+}  // namespace
+
+LanczosSolver::LanczosSolver(const LinearOperator& op, std::size_t size, std::size_t k, Which which, double tolerance,
+                             std::size_t max_iterations)
+    : size_(size), k_(k), which_(which), tolerance_(tolerance), max_iterations_(max_iterations) {
+    Solve(op);
+}
+
+LanczosSolver::LanczosSolver(const Matrix& mat, std::size_t k, Which which, double tolerance,
+                             std::size_t max_iterations)
+    : size_(mat.Row()), k_(k), which_(which), tolerance_(tolerance), max_iterations_(max_iterations) {
+    if (mat.Row() != mat.Col()) {
+        throw std::invalid_argument("Eigen should be square matrix");
+    }
+    Solve(MakeLinearOperator(mat));
+}
+
+Matrix LanczosSolver::Eigenvalues() const { return eigenvalues_; }
+
+Matrix LanczosSolver::Eigenvectors() const { return eigenvectors_; }
+
+bool LanczosSolver::IsConverged() const { return converged_; }
+
+std::size_t LanczosSolver::Iterations() const { return iterations_; }
+
+std::size_t LanczosSolver::OperatorCalls() const { return operator_calls_; }
+
+void LanczosSolver::Solve(const LinearOperator& op) {
+    if ((k_ == 0) || (k_ > size_)) {
+        throw std::invalid_argument("check k, it should be 1 <= k <= size");
+    }
+    const std::size_t n = size_;
+    const std::size_t m = std::min(n, std::max(2 * k_ + 1, k_ + kExtraVectors));
+    subspace_ = m;
+    basis_ = Matrix(m, n);
+    projected_ = Matrix(m, m);
+
+    Matrix start = Matrix::Random(1, n);
+    kernel::Scale(1.0 / kernel::Norm2(start), start);
+    kernel::Copy(start, basis_.RowView(0));
+
+    const double min_scale = std::pow(std::numeric_limits<double>::epsilon(), 2.0 / 3.0);
+    Matrix residual(1, n);
+    std::size_t kept = 0;
+    for (iterations_ = 1;; ++iterations_) {
+        const double beta = Expand(op, kept, residual);
+
+        // Ritz pairs of the basis. |A * x - value * x| = |beta * y(m - 1)| for x = V^T * y.
+        SymmetricEigenSolver ritz(projected_);
+        const Matrix values = ritz.Eigenvalues();
+        const Matrix vectors = ritz.Eigenvectors();
+        const std::vector<std::size_t> order = Select(values);
+
+        converged_ = true;
+        for (std::size_t i = 0; i < k_; ++i) {
+            const double value = values(order[i], 0);
+            const double error = std::abs(beta * vectors(m - 1, order[i]));
+            if (error > tolerance_ * std::max(std::abs(value), min_scale)) {
+                converged_ = false;
+                break;
+            }
+        }
+
+        const bool last = converged_ || (iterations_ >= max_iterations_) || (m <= k_);
+        const std::size_t keep = last ? k_ : std::min(m - 1, k_ + (m - k_) / 2);
+        Matrix selected(m, keep);
+        for (std::size_t i = 0; i < keep; ++i) {
+            kernel::Copy(vectors.ColView(order[i]), selected.ColView(i));
+        }
+
+        if (last) {
+            eigenvalues_ = Matrix(k_, 1);
+            for (std::size_t i = 0; i < k_; ++i) {
+                eigenvalues_(i, 0) = values(order[i], 0);
+            }
+            eigenvectors_ = Matrix(n, k_);
+            kernel::Gemm(1.0, basis_.View().Transpose(), selected, 0.0, eigenvectors_);
+            break;
+        }
+
+        // Thick restart: the kept Ritz vectors and the residual direction start the next basis.
+        Matrix restarted(keep, n);
+        kernel::Gemm(1.0, selected.View().Transpose(), basis_, 0.0, restarted);
+        kernel::Copy(restarted, basis_.Block(0, 0, keep, n));
+        kernel::Scale(1.0 / beta, residual);
+        kernel::Copy(residual, basis_.RowView(keep));
+
+        projected_ = Matrix(m, m);
+        for (std::size_t i = 0; i < keep; ++i) {
+            projected_(i, i) = values(order[i], 0);
+        }
+        kept = keep;
+    }
+}
+
+double LanczosSolver::Expand(const LinearOperator& op, std::size_t first, Matrix& residual) {
+    const std::size_t m = subspace_;
+    const std::size_t n = size_;
+    Matrix coefficients(1, m);
+    Matrix correction(1, m);
+    double beta = 0.0;
+
+    for (std::size_t j = first; j < m; ++j) {
+        op(basis_.RowView(j).Transpose(), residual.View().Transpose());
+        ++operator_calls_;
+        const double norm = kernel::Norm2(residual);
+
+        // Coefficients on every basis vector, twice to keep the basis orthogonal to working precision. They are the
+        // new column of V^T * A * V, including the couplings to Ritz vectors kept by a restart.
+        const ConstMatrixView basis = basis_.Block(0, 0, j + 1, n);
+        const MatrixView c = coefficients.Block(0, 0, 1, j + 1);
+        const MatrixView dc = correction.Block(0, 0, 1, j + 1);
+        kernel::Gemm(1.0, residual, basis.Transpose(), 0.0, c);
+        kernel::Gemm(-1.0, c, basis, 1.0, residual);
+        kernel::Gemm(1.0, residual, basis.Transpose(), 0.0, dc);
+        kernel::Gemm(-1.0, dc, basis, 1.0, residual);
+        kernel::Axpy(1.0, dc, c);
+
+        for (std::size_t i = 0; i <= j; ++i) {
+            projected_(i, j) = c(0, i);
+            projected_(j, i) = c(0, i);
+        }
+
+        beta = kernel::Norm2(residual);
+        if (j + 1 == m) {
+            break;
+        }
+
+        if (beta <= kBreakdown * norm) {
+            // Invariant subspace, continue with any direction orthogonal to it.
+            residual = Matrix::Random(1, n);
+            Orthogonalize(j + 1, residual);
+            kernel::Scale(1.0 / kernel::Norm2(residual), residual);
+        } else {
+            kernel::Scale(1.0 / beta, residual);
+        }
+        kernel::Copy(residual, basis_.RowView(j + 1));
+    }
+    return beta;
+}
+
+void LanczosSolver::Orthogonalize(std::size_t count, const MatrixView& vector) const {
+    const ConstMatrixView basis = basis_.Block(0, 0, count, size_);
+    Matrix coefficients(1, count);
+    for (int pass = 0; pass < 2; ++pass) {
+        kernel::Gemm(1.0, vector, basis.Transpose(), 0.0, coefficients);
+        kernel::Gemm(-1.0, coefficients, basis, 1.0, vector);
+    }
+}
+
+std::vector<std::size_t> LanczosSolver::Select(const Matrix& values) const {
+    std::vector<std::size_t> order(values.Row());
+    std::iota(std::begin(order), std::end(order), 0);
+    auto key = [this, &values](std::size_t index) {
+        const double value = values(index, 0);
+        switch (which_) {
+            case Which::kLargestMagnitude:
+                return -std::abs(value);
+            case Which::kLargestAlgebraic:
+                return -value;
+            case Which::kSmallestAlgebraic:
+            default:
+                return value;
+        }
+    };
+    std::stable_sort(std::begin(order), std::end(order),
+                     [&key](std::size_t lhs, std::size_t rhs) { return key(lhs) < key(rhs); });
+    return order;
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
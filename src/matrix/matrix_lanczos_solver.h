@@ -0,0 +1,81 @@
+/// @file matrix_lanczos_solver.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Partial eigen decomposition of large symmetric operators.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_LANCZOS_SOLVER_H_
+#define SRC_MATRIX_MATRIX_LANCZOS_SOLVER_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_linear_operator.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief k eigen pairs of a symmetric operator by thick-restart Lanczos.
+/// The Krylov basis is fully reorthogonalized, at most 2k + 20 vectors are kept and each restart keeps the best Ritz
+/// vectors found so far. Costs a few hundred products with A instead of a full O(n^3) decomposition.
+class LanczosSolver {
+ public:
+    enum class Which {
+        kLargestMagnitude,
+        kLargestAlgebraic,
+        kSmallestAlgebraic,
+    };
+
+    /// @param op y = A * x of a symmetric n x n operator.
+    /// @param size n
+    /// @param k number of eigen pairs, 1 <= k <= n.
+    /// @param tolerance A pair has converged when |A * v - value * v| <= tolerance * |value|.
+    /// @param max_iterations Restarts allowed. The best pairs found so far are returned when they run out.
+    LanczosSolver(const LinearOperator& op, std::size_t size, std::size_t k, Which which = Which::kLargestMagnitude,
+                  double tolerance = 1e-10, std::size_t max_iterations = 300);
+    LanczosSolver(const Matrix& mat, std::size_t k, Which which = Which::kLargestMagnitude, double tolerance = 1e-10,
+                  std::size_t max_iterations = 300);
+
+    /// @brief k x 1, in the order asked by Which.
+    Matrix Eigenvalues() const;
+    /// @brief n x k, column i belongs to eigenvalue i.
+    Matrix Eigenvectors() const;
+
+    bool IsConverged() const;
+    std::size_t Iterations() const;
+    std::size_t OperatorCalls() const;
+
+ private:
+    void Solve(const LinearOperator& op);
+    /// Extends basis_ from row `first` to a full Krylov basis, fills projected_ and returns the last residual norm.
+    double Expand(const LinearOperator& op, std::size_t first, Matrix& residual);
+    void Orthogonalize(std::size_t count, const MatrixView& vector) const;
+    std::vector<std::size_t> Select(const Matrix& values) const;
+
+    std::size_t size_;
+    std::size_t k_;
+    Which which_;
+    double tolerance_;
+    std::size_t max_iterations_;
+    std::size_t subspace_{};
+
+    /// Row i is Lanczos vector i.
+    Matrix basis_{};
+    /// V^T * A * V on the basis.
+    Matrix projected_{};
+
+    Matrix eigenvalues_{};
+    Matrix eigenvectors_{};
+    bool converged_{false};
+    std::size_t iterations_{};
+    std::size_t operator_calls_{};
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_LANCZOS_SOLVER_H_
@@ -0,0 +1,49 @@
+/// @file matrix_linear_operator.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_linear_operator.h"
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "src/matrix/matrix_kernel.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+
+LinearOperator MakeLinearOperator(const Matrix& mat) {
+    const Matrix* matrix = &mat;
+    return [matrix](const ConstMatrixView& x, const MatrixView& y) {
+        if ((x.Row() != matrix->Col()) || (y.Row() != matrix->Row()) || (x.Col() != 1) || (y.Col() != 1)) {
+            throw std::invalid_argument("cannot matrix multiply, check size!");
+        }
+        // One dot product per row, x read as a row vector.
+        const ConstMatrixView x_row = x.Transpose();
+        parallel::ParallelFor(0, matrix->Row(), matrix->Col(), [&](std::size_t first, std::size_t last) {
+            for (std::size_t r = first; r < last; ++r) {
+                y.AtUnchecked(r, 0) = kernel::Dot(matrix->RowView(r), x_row);
+            }
+        });
+    };
+}
+
+LinearOperator MakeLinearOperator(const SparseMatrix& mat) {
+    const SparseMatrix* matrix = &mat;
+    return [matrix](const ConstMatrixView& x, const MatrixView& y) {
+        if ((x.Col() != 1) || (y.Col() != 1)) {
+            throw std::invalid_argument("cannot matrix multiply, check size!");
+        }
+        SpMM(1.0, *matrix, x, 0.0, y);
+    };
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,35 @@
+/// @file matrix_linear_operator.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Matrix-free linear operators.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_LINEAR_OPERATOR_H_
+#define SRC_MATRIX_MATRIX_LINEAR_OPERATOR_H_
+
+#include <functional>
+
+#include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_sparse.h"
+#include "src/matrix/matrix_view.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Computes y = A * x for n x 1 views x and y. Iterative solvers only touch A through this callback, so A can be
+/// implicit, sparse or distributed. x may be strided and never aliases y.
+using LinearOperator = std::function<void(const ConstMatrixView& x, const MatrixView& y)>;
+
+/// @brief Operator of a dense matrix. The matrix is referenced, not copied, and must outlive the operator.
+LinearOperator MakeLinearOperator(const Matrix& mat);
+
+/// @brief Operator of a sparse matrix through SpMM, referenced like the dense one.
+LinearOperator MakeLinearOperator(const SparseMatrix& mat);
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_LINEAR_OPERATOR_H_
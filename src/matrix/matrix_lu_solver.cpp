@@ -0,0 +1,211 @@
+/// @file matrix_lu_solver.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_lu_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "src/matrix/matrix_kernel.h"
+#include "src/matrix/matrix_simd.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+
+namespace {
+// Columns per panel. Panels are factored with row operations, everything right of a panel is updated by one GEMM.
+constexpr std::size_t kBlock = 64;
+}  // namespace
+
+LUSolver::LUSolver(const Matrix& mat) : lu_(mat), pivots_(mat.Row()) {
+    if (mat.Row() != mat.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+    Factorize();
+}
+
+bool LUSolver::IsSingular() const { return singular_; }
+
+void LUSolver::Factorize() {
+    const std::size_t n = lu_.Row();
+    for (std::size_t start = 0; start < n; start += kBlock) {
+        const std::size_t width = std::min(kBlock, n - start);
+        const std::size_t end = start + width;
+        FactorizePanel(start, width);
+        if (end == n) {
+            break;
+        }
+
+        // U12 = L11^-1 * A12
+        for (std::size_t i = start + 1; i < end; ++i) {
+            for (std::size_t k = start; k < i; ++k) {
+                kernel::Axpy(-lu_.AtUnchecked(i, k), lu_.Block(k, end, 1, n - end), lu_.Block(i, end, 1, n - end));
+            }
+        }
+
+        // A22 -= L21 * U12
+        kernel::Gemm(-1.0, lu_.Block(end, start, n - end, width), lu_.Block(start, end, width, n - end), 1.0,
+                     lu_.Block(end, end, n - end, n - end));
+    }
+}
+
+void LUSolver::FactorizePanel(std::size_t start, std::size_t width) {
+    const std::size_t n = lu_.Row();
+    const std::size_t panel_end = start + width;
+    double* data = lu_.Data();
+    for (std::size_t j = start; j < panel_end; ++j) {
+        std::size_t pivot_index = j;
+        for (std::size_t i = j + 1; i < n; ++i) {
+            if (std::abs(data[i * n + j]) > std::abs(data[pivot_index * n + j])) {
+                pivot_index = i;
+            }
+        }
+
+        // Whole rows are swapped, so L left of the panel stays consistent with P * A = L * U.
+        pivots_[j] = pivot_index;
+        if (pivot_index != j) {
+            std::swap_ranges(data + j * n, data + (j + 1) * n, data + pivot_index * n);
+            sign_ = -sign_;
+        }
+
+        const double pivot = data[j * n + j];
+        if (pivot == 0.0) {
+            singular_ = true;
+            continue;
+        }
+
+        const double* pivot_row = data + j * n;
+        const std::size_t length = panel_end - j - 1;
+        parallel::ParallelFor(j + 1, n, length + 1, [=](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                double* row = data + i * n;
+                row[j] /= pivot;
+                simd::Axpy(-row[j], pivot_row + j + 1, row + j + 1, length);
+            }
+        });
+    }
+}
+
+Matrix LUSolver::Solve(const Matrix& rhs) const {
+    Matrix result = rhs;
+    SolveInPlace(result);
+    return result;
+}
+
+void LUSolver::SolveInPlace(const MatrixView& rhs) const {
+    if (singular_) {
+        throw std::invalid_argument("matrix is singular");
+    }
+    const std::size_t n = lu_.Row();
+    if (rhs.Row() != n) {
+        throw std::invalid_argument("check size, rhs should have as many rows as the matrix");
+    }
+    const std::size_t m = rhs.Col();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        if (pivots_[i] != i) {
+            for (std::size_t c = 0; c < m; ++c) {
+                std::swap(rhs.AtUnchecked(i, c), rhs.AtUnchecked(pivots_[i], c));
+            }
+        }
+    }
+
+    // Forward substitution with L. Within a block row by row, below it one GEMM for all right hand sides.
+    for (std::size_t start = 0; start < n; start += kBlock) {
+        const std::size_t end = std::min(start + kBlock, n);
+        for (std::size_t i = start + 1; i < end; ++i) {
+            for (std::size_t k = start; k < i; ++k) {
+                kernel::Axpy(-lu_.AtUnchecked(i, k), rhs.RowView(k), rhs.RowView(i));
+            }
+        }
+        if (end < n) {
+            kernel::Gemm(-1.0, lu_.Block(end, start, n - end, end - start), rhs.Block(start, 0, end - start, m), 1.0,
+                         rhs.Block(end, 0, n - end, m));
+        }
+    }
+
+    // Backward substitution with U, same blocks from the bottom.
+    for (std::size_t end = n; end > 0;) {
+        const std::size_t start = ((end - 1) / kBlock) * kBlock;
+        for (std::size_t i = end; i-- > start;) {
+            for (std::size_t k = i + 1; k < end; ++k) {
+                kernel::Axpy(-lu_.AtUnchecked(i, k), rhs.RowView(k), rhs.RowView(i));
+            }
+            kernel::Scale(1.0 / lu_.AtUnchecked(i, i), rhs.RowView(i));
+        }
+        if (start > 0) {
+            kernel::Gemm(-1.0, lu_.Block(0, start, start, end - start), rhs.Block(start, 0, end - start, m), 1.0,
+                         rhs.Block(0, 0, start, m));
+        }
+        end = start;
+    }
+}
+
+Matrix LUSolver::Inverse() const {
+    Matrix result = Matrix::Identity(lu_.Row());
+    SolveInPlace(result);
+    return result;
+}
+
+double LUSolver::Determinant() const {
+    if (singular_) {
+        return 0.0;
+    }
+    double det = sign_;
+    for (std::size_t i = 0; i < lu_.Row(); ++i) {
+        det *= lu_.AtUnchecked(i, i);
+    }
+    return det;
+}
+
+std::pair<double, double> LUSolver::LogDeterminant() const {
+    if (singular_) {
+        return std::make_pair(0.0, -std::numeric_limits<double>::infinity());
+    }
+    double sign = sign_;
+    double log_abs = 0.0;
+    for (std::size_t i = 0; i < lu_.Row(); ++i) {
+        const double diagonal = lu_.AtUnchecked(i, i);
+        if (diagonal < 0.0) {
+            sign = -sign;
+        }
+        log_abs += std::log(std::abs(diagonal));
+    }
+    return std::make_pair(sign, log_abs);
+}
+
+Matrix LUSolver::Lower() const {
+    Matrix result = Matrix::Identity(lu_.Row());
+    for (std::size_t r = 1; r < lu_.Row(); ++r) {
+        for (std::size_t c = 0; c < r; ++c) {
+            result.AtUnchecked(r, c) = lu_.AtUnchecked(r, c);
+        }
+    }
+    return result;
+}
+
+Matrix LUSolver::Upper() const {
+    Matrix result(lu_.Row(), lu_.Col());
+    for (std::size_t r = 0; r < lu_.Row(); ++r) {
+        for (std::size_t c = r; c < lu_.Col(); ++c) {
+            result.AtUnchecked(r, c) = lu_.AtUnchecked(r, c);
+        }
+    }
+    return result;
+}
+
+const memory::Vector<std::size_t>& LUSolver::Pivots() const { return pivots_; }
+
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,66 @@
+/// @file matrix_lu_solver.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief LU decomposition with partial pivoting.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_LU_SOLVER_H_
+#define SRC_MATRIX_MATRIX_LU_SOLVER_H_
+
+#include <cstddef>
+#include <utility>
+
+#include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_view.h"
+#include "src/memory/allocator.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Factors a square matrix once as P * A = L * U, then solves against any number of right hand sides.
+/// L is unit lower triangular and U is upper triangular, both are stored in one matrix. The factorization is blocked
+/// and right-looking, the trailing updates run on the GEMM kernel. The factors are allocated from the current
+/// memory::AllocatorScope, a solver made inside a memory::Workspace::Frame allocates nothing once the workspace is
+/// warm.
+class LUSolver {
+ public:
+    explicit LUSolver(const Matrix& mat);
+
+    /// @brief A zero pivot was met. Solve and Inverse throw on singular matrices, Determinant returns 0.
+    bool IsSingular() const;
+
+    /// @brief Solves A * X = B. B is n x m, a column vector or a block of right hand sides.
+    Matrix Solve(const Matrix& rhs) const;
+
+    /// @brief Solves A * X = B and overwrites B with X.
+    void SolveInPlace(const MatrixView& rhs) const;
+
+    Matrix Inverse() const;
+    double Determinant() const;
+    /// @brief {sign, log|det|}, summed from the diagonal of U so it does not overflow. Singular gives {0, -inf}.
+    std::pair<double, double> LogDeterminant() const;
+
+    /// @brief Unit lower triangular factor L.
+    Matrix Lower() const;
+    /// @brief Upper triangular factor U.
+    Matrix Upper() const;
+    /// @brief Row i was swapped with row Pivots()[i] at step i of the elimination.
+    const memory::Vector<std::size_t>& Pivots() const;
+
+ private:
+    void Factorize();
+    void FactorizePanel(std::size_t start, std::size_t width);
+
+    Matrix lu_{};
+    memory::Vector<std::size_t> pivots_{};
+    bool singular_{false};
+    int sign_{1};
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_LU_SOLVER_H_
@@ -10,83 +10,104 @@
 
 #include "src/matrix/matrix_operation.h"
 
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_gemm.h"
+#include "src/matrix/matrix_lu_solver.h"
 
 namespace math_cpp {
 namespace matrix {
 
-Matrix operator+(const Matrix& lhs, const Matrix& rhs) {
-    Matrix result = lhs;
-    result += rhs;
+void ProductChain::Push(const Matrix& factor) { factors_.push_back(&factor); }
 
-    return result;
+void ProductChain::Own(Matrix&& factor) {
+    owned_.push_back(std::move(factor));
+    factors_.push_back(&owned_.back());
 }
 
-Matrix operator-(const Matrix& lhs, const Matrix& rhs) {
-    Matrix result = lhs;
-    result -= rhs;
+void ProductChain::Scale(double scalar) { scalar_ *= scalar; }
 
-    return result;
-}
-
-Matrix operator*(const Matrix& lhs, const Matrix& rhs) {
-    if (!lhs.CanMultiply(rhs)) {
-        throw std::invalid_argument("cannot matrix multiply, check size!");
+Matrix ProductChain::Multiply() const {
+    const std::size_t count = factors_.size();
+    if (count == 1) {
+        Matrix result = *factors_.front();
+        result *= scalar_;
+        return result;
     }
 
-    Matrix result(lhs.Row(), rhs.Col());
+    // dims[i] x dims[i + 1] is the shape of factor i. cost(i, j) is the cheapest way to multiply factors [i, j].
+    std::vector<double> dims(count + 1);
+    dims[0] = static_cast<double>(factors_.front()->Row());
+    for (std::size_t i = 0; i < count; ++i) {
+        dims[i + 1] = static_cast<double>(factors_[i]->Col());
+    }
 
-    for (std::size_t r = 0; r < result.Row(); ++r) {
-        for (std::size_t c = 0; c < result.Col(); ++c) {
-            for (std::size_t m = 0; m < lhs.Col(); ++m) {
-                result(r, c) += lhs(r, m) * rhs(m, c);
+    std::vector<double> cost(count * count, 0.0);
+    std::vector<std::size_t> split(count * count, 0);
+    for (std::size_t length = 2; length <= count; ++length) {
+        for (std::size_t i = 0; i + length <= count; ++i) {
+            const std::size_t j = i + length - 1;
+            cost[i * count + j] = -1.0;
+            for (std::size_t s = i; s < j; ++s) {
+                const double candidate =
+                    cost[i * count + s] + cost[(s + 1) * count + j] + dims[i] * dims[s + 1] * dims[j + 1];
+                if ((cost[i * count + j] < 0.0) || (candidate < cost[i * count + j])) {
+                    cost[i * count + j] = candidate;
+                    split[i * count + j] = s;
+                }
             }
         }
     }
-    return result;
-}
-
-Matrix operator/(const Matrix& lhs, const Matrix& rhs) {
-    Matrix inv_rhs = rhs.Inverse();
 
-    return (lhs * inv_rhs);
+    return Multiply(split, 0, count - 1);
 }
 
-Matrix operator+(double scalar, const Matrix& rhs) {
-    Matrix scalar_matrix(rhs.Row(), rhs.Col(), scalar);
-
-    return (scalar_matrix + rhs);
-}
+Matrix ProductChain::Multiply(const std::vector<std::size_t>& split, std::size_t first, std::size_t last) const {
+    const std::size_t count = factors_.size();
+    const std::size_t s = split[first * count + last];
+
+    // Sub-chains of a single factor are used in place, longer ones are evaluated first.
+    Matrix lhs_product{};
+    Matrix rhs_product{};
+    const Matrix* lhs = factors_[first];
+    const Matrix* rhs = factors_[last];
+    if (s > first) {
+        lhs_product = Multiply(split, first, s);
+        lhs = &lhs_product;
+    }
+    if (s + 1 < last) {
+        rhs_product = Multiply(split, s + 1, last);
+        rhs = &rhs_product;
+    }
 
-Matrix operator-(double scalar, const Matrix& rhs) {
-    Matrix scalar_matrix(rhs.Row(), rhs.Col(), scalar);
+    // The scalar factor is applied once, by the outermost product.
+    const double alpha = ((first == 0) && (last + 1 == count)) ? scalar_ : 1.0;
 
-    return (scalar_matrix - rhs);
+    Matrix result(lhs->Row(), rhs->Col());
+    kernel::Gemm(lhs->Row(), rhs->Col(), lhs->Col(), alpha, lhs->Data(), lhs->Col(), rhs->Data(), rhs->Col(), 0.0,
+                 result.Data(), result.Col());
+    return result;
 }
 
-Matrix operator*(double scalar, const Matrix& rhs) {
-    Matrix result(rhs);
-
-    result *= scalar;
-
-    return result;
+Matrix operator/(const Matrix& lhs, const Matrix& rhs) {
+    // X = lhs * rhs^-1 solves X * rhs = lhs, that is rhs^T * X^T = lhs^T. No inverse is formed.
+    if (lhs.Col() != rhs.Row()) {
+        throw std::invalid_argument("cannot matrix divide, check size!");
+    }
+    return LUSolver(rhs.Transpose()).Solve(lhs.Transpose()).Transpose();
 }
 
 Matrix operator/(double scalar, const Matrix& rhs) {
-    Matrix result = rhs.Inverse();
+    Matrix result = LUSolver(rhs).Inverse();
 
     result *= scalar;
 
     return result;
 }
 
-Matrix operator+(const Matrix& lhs, double scalar) { return scalar + lhs; }
-
-Matrix operator-(const Matrix& lhs, double scalar) { return (-scalar) + lhs; }
-
-Matrix operator/(const Matrix& lhs, double scalar) { return lhs * (1.0 / scalar); }
-
-Matrix operator*(const Matrix& lhs, double scalar) { return scalar * lhs; }
-
 }  // namespace matrix
 }  // namespace math_cpp
@@ -6,28 +6,356 @@
 ///
 /// @copyright Copyright (c) 2022
 ///
+/// Arithmetic on Matrix is lazy. Operators build an expression that is evaluated when it is assigned (or converted)
+/// to a Matrix. Elementwise chains such as `a * A + b * B - 1.0` run as one fused pass without temporaries, and
+/// chains of matrix products are multiplied in the cheapest order, e.g. `A * A * v` is computed as `A * (A * v)`.
+///
+/// Named Matrix operands are referenced and temporary ones, such as `A.Transpose()`, are moved into the expression, so
+/// an expression kept in `auto` stays valid as long as the named matrices do. Expressions also have the read-only part
+/// of the Matrix interface, e.g. `(a * b).Transpose()` or `(a + b)(0, 0)`, which evaluates them first.
 ///
 #ifndef SRC_MATRIX_MATRIX_OPERATION_H_
 #define SRC_MATRIX_MATRIX_OPERATION_H_
 
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "src/matrix/matrix_core.h"
+#include "src/parallel/thread_pool.h"
 
 namespace math_cpp {
 namespace matrix {
-Matrix operator+(const Matrix& lhs, const Matrix& rhs);
-Matrix operator-(const Matrix& lhs, const Matrix& rhs);
-Matrix operator*(const Matrix& lhs, const Matrix& rhs);
+
+/// @brief Factors of a matrix product chain, collected from an expression tree before it is multiplied.
+class ProductChain {
+ public:
+    void Push(const Matrix& factor);
+    void Own(Matrix&& factor);
+    void Scale(double scalar);
+
+    /// @brief Multiplies the factors in the order with the fewest flops (matrix chain ordering) and scales the result.
+    Matrix Multiply() const;
+
+ private:
+    Matrix Multiply(const std::vector<std::size_t>& split, std::size_t first, std::size_t last) const;
+
+    std::vector<const Matrix*> factors_{};
+    std::deque<Matrix> owned_{};
+    double scalar_{1.0};
+};
+
+template <typename Derived>
+class MatrixExpression {
+ public:
+    const Derived& Self() const { return static_cast<const Derived&>(*this); }
+
+    /// @brief Evaluates an elementwise expression into a new Matrix.
+    Matrix Eval() const {
+        Matrix result(Self().Row(), Self().Col());
+        AssignTo(result.Data());
+        return result;
+    }
+
+    /// @brief Writes the expression to dst, which has the shape of the expression. Products are evaluated first.
+    void AssignTo(double* dst) const {
+        const Derived& self = Self();
+        self.Prepare();
+        parallel::ParallelFor(0, self.Row() * self.Col(), 1, [&self, dst](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                dst[i] = self.At(i);
+            }
+        });
+    }
+
+    /// @brief Default for operands of a product: evaluate and hand over the result.
+    void CollectInto(ProductChain& chain) const { chain.Own(Self().Eval()); }
+
+    operator Matrix() const { return Self().Eval(); }  // NOLINT(google-explicit-constructor)
+
+    explicit operator double() const {
+        Matrix value = Self().Eval();
+        return static_cast<double>(value);
+    }
+
+    double operator()(std::size_t row, std::size_t col) const { return Self().Eval()(row, col); }
+    bool operator==(const Matrix& other) const { return Self().Eval() == other; }
+    bool operator!=(const Matrix& other) const { return Self().Eval() != other; }
+    bool IsSameSize(const Matrix& other) const { return Self().Eval().IsSameSize(other); }
+    bool CanMultiply(const Matrix& other) const { return Self().Eval().CanMultiply(other); }
+
+    Matrix Inverse() const { return Self().Eval().Inverse(); }
+    Matrix Transpose() const { return Self().Eval().Transpose(); }
+    Matrix GetCol(std::size_t idx) const { return Self().Eval().GetCol(idx); }
+    Matrix GetRow(std::size_t idx) const { return Self().Eval().GetRow(idx); }
+    /// @brief Elementwise absolute value of the evaluated expression.
+    Matrix Absolute() const {
+        Matrix result = Self().Eval();
+        result.Absolute();
+        return result;
+    }
+};
+
+/// @brief Leaf of an expression, refers to an existing Matrix.
+class MatrixRef : public MatrixExpression<MatrixRef> {
+ public:
+    explicit MatrixRef(const Matrix& matrix) : matrix_(&matrix) {}
+
+    std::size_t Row() const { return matrix_->Row(); }
+    std::size_t Col() const { return matrix_->Col(); }
+    double At(std::size_t index) const { return matrix_->Data()[index]; }
+    void Prepare() const {}
+
+    Matrix Eval() const { return *matrix_; }
+    void CollectInto(ProductChain& chain) const { chain.Push(*matrix_); }
+
+ private:
+    const Matrix* matrix_;
+};
+
+/// @brief Leaf of an expression that owns its Matrix, for temporary operands that would not outlive the expression.
+class MatrixValue : public MatrixExpression<MatrixValue> {
+ public:
+    explicit MatrixValue(Matrix&& matrix) : matrix_(std::move(matrix)) {}
+
+    std::size_t Row() const { return matrix_.Row(); }
+    std::size_t Col() const { return matrix_.Col(); }
+    double At(std::size_t index) const { return matrix_.Data()[index]; }
+    void Prepare() const {}
+
+    Matrix Eval() const { return matrix_; }
+    void CollectInto(ProductChain& chain) const { chain.Push(matrix_); }
+
+ private:
+    Matrix matrix_;
+};
+
+struct PlusOp {
+    double operator()(double lhs, double rhs) const { return lhs + rhs; }
+};
+struct MinusOp {
+    double operator()(double lhs, double rhs) const { return lhs - rhs; }
+};
+
+/// x + value
+struct ShiftBy {
+    double value;
+    double operator()(double x) const { return x + value; }
+};
+/// x * value
+struct ScaleBy {
+    double value;
+    double operator()(double x) const { return x * value; }
+};
+/// value - x
+struct SubtractFrom {
+    double value;
+    double operator()(double x) const { return value - x; }
+};
+
+template <typename L, typename R, typename Op>
+class ElementwiseBinary : public MatrixExpression<ElementwiseBinary<L, R, Op>> {
+ public:
+    ElementwiseBinary(L lhs, R rhs) : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {
+        if ((lhs_.Row() != rhs_.Row()) || (lhs_.Col() != rhs_.Col())) {
+            std::string throw_msg = "other matrix must be same size [*this] (" + std::to_string(lhs_.Row()) + ", " +
+                                    std::to_string(lhs_.Col()) + ")!";
+            throw std::invalid_argument(throw_msg);
+        }
+    }
+
+    std::size_t Row() const { return lhs_.Row(); }
+    std::size_t Col() const { return lhs_.Col(); }
+    double At(std::size_t index) const { return Op{}(lhs_.At(index), rhs_.At(index)); }
+    void Prepare() const {
+        lhs_.Prepare();
+        rhs_.Prepare();
+    }
+
+ private:
+    L lhs_;
+    R rhs_;
+};
+
+template <typename E, typename F>
+class ElementwiseMap : public MatrixExpression<ElementwiseMap<E, F>> {
+ public:
+    ElementwiseMap(E expression, F function) : expression_(std::move(expression)), function_(function) {}
+
+    std::size_t Row() const { return expression_.Row(); }
+    std::size_t Col() const { return expression_.Col(); }
+    double At(std::size_t index) const { return function_(expression_.At(index)); }
+    void Prepare() const { expression_.Prepare(); }
+
+    void CollectInto(ProductChain& chain) const { Collect(chain, function_); }
+
+ private:
+    template <typename G>
+    void Collect(ProductChain& chain, const G& /*function*/) const {
+        chain.Own(this->Eval());
+    }
+    // Scalars are pulled out of products, (s * A) * B is evaluated as s * (A * B) in a single GEMM.
+    void Collect(ProductChain& chain, const ScaleBy& function) const {
+        chain.Scale(function.value);
+        expression_.CollectInto(chain);
+    }
+
+    E expression_;
+    F function_;
+};
+
+template <typename L, typename R>
+class MatrixProduct : public MatrixExpression<MatrixProduct<L, R>> {
+ public:
+    MatrixProduct(L lhs, R rhs) : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {
+        if (lhs_.Col() != rhs_.Row()) {
+            throw std::invalid_argument("cannot matrix multiply, check size!");
+        }
+    }
+
+    std::size_t Row() const { return lhs_.Row(); }
+    std::size_t Col() const { return rhs_.Col(); }
+
+    /// Element access inside an elementwise expression reads the product evaluated by Prepare().
+    double At(std::size_t index) const { return value_.Data()[index]; }
+    void Prepare() const { value_ = Eval(); }
+
+    Matrix Eval() const {
+        ProductChain chain{};
+        CollectInto(chain);
+        return chain.Multiply();
+    }
+    void CollectInto(ProductChain& chain) const {
+        lhs_.CollectInto(chain);
+        rhs_.CollectInto(chain);
+    }
+
+ private:
+    L lhs_;
+    R rhs_;
+    mutable Matrix value_{};
+};
+
+template <typename T, typename U = typename std::decay<T>::type>
+struct IsMatrixOperand
+    : std::integral_constant<bool, std::is_same<U, Matrix>::value || std::is_base_of<MatrixExpression<U>, U>::value> {
+};
+
+/// @brief Maps a forwarded operand to its expression node. A named Matrix becomes a MatrixRef and a temporary one a
+/// MatrixValue, expressions are moved or copied into the new node.
+template <typename T>
+struct ExpressionOf {
+    using Type = typename std::decay<T>::type;
+    static Type Make(T&& operand) { return std::forward<T>(operand); }
+};
+template <>
+struct ExpressionOf<Matrix&> {
+    using Type = MatrixRef;
+    static MatrixRef Make(const Matrix& operand) { return MatrixRef(operand); }
+};
+template <>
+struct ExpressionOf<const Matrix&> {
+    using Type = MatrixRef;
+    static MatrixRef Make(const Matrix& operand) { return MatrixRef(operand); }
+};
+template <>
+struct ExpressionOf<Matrix> {
+    using Type = MatrixValue;
+    static MatrixValue Make(Matrix&& operand) { return MatrixValue(std::move(operand)); }
+};
+template <>
+struct ExpressionOf<const Matrix> {
+    using Type = MatrixValue;
+    static MatrixValue Make(const Matrix& operand) { return MatrixValue(Matrix(operand)); }
+};
+
+template <typename T>
+using ExpressionType = typename ExpressionOf<T>::Type;
+
+template <typename L, typename R>
+using EnableIfOperands = typename std::enable_if<IsMatrixOperand<L>::value && IsMatrixOperand<R>::value>::type;
+
+template <typename T>
+using EnableIfOperand = typename std::enable_if<IsMatrixOperand<T>::value>::type;
+
+template <typename L, typename R, typename = EnableIfOperands<L, R>>
+ElementwiseBinary<ExpressionType<L>, ExpressionType<R>, PlusOp> operator+(L&& lhs, R&& rhs) {
+    return {ExpressionOf<L>::Make(std::forward<L>(lhs)), ExpressionOf<R>::Make(std::forward<R>(rhs))};
+}
+
+template <typename L, typename R, typename = EnableIfOperands<L, R>>
+ElementwiseBinary<ExpressionType<L>, ExpressionType<R>, MinusOp> operator-(L&& lhs, R&& rhs) {
+    return {ExpressionOf<L>::Make(std::forward<L>(lhs)), ExpressionOf<R>::Make(std::forward<R>(rhs))};
+}
+
+template <typename L, typename R, typename = EnableIfOperands<L, R>>
+MatrixProduct<ExpressionType<L>, ExpressionType<R>> operator*(L&& lhs, R&& rhs) {
+    return {ExpressionOf<L>::Make(std::forward<L>(lhs)), ExpressionOf<R>::Make(std::forward<R>(rhs))};
+}
+
 Matrix operator/(const Matrix& lhs, const Matrix& rhs);
 
-Matrix operator+(double scalar, const Matrix& rhs);
-Matrix operator-(double scalar, const Matrix& rhs);
-Matrix operator*(double scalar, const Matrix& rhs);
+template <typename R, typename = EnableIfOperand<R>>
+ElementwiseMap<ExpressionType<R>, ShiftBy> operator+(double scalar, R&& rhs) {
+    return {ExpressionOf<R>::Make(std::forward<R>(rhs)), ShiftBy{scalar}};
+}
+
+template <typename R, typename = EnableIfOperand<R>>
+ElementwiseMap<ExpressionType<R>, SubtractFrom> operator-(double scalar, R&& rhs) {
+    return {ExpressionOf<R>::Make(std::forward<R>(rhs)), SubtractFrom{scalar}};
+}
+
+template <typename R, typename = EnableIfOperand<R>>
+ElementwiseMap<ExpressionType<R>, ScaleBy> operator*(double scalar, R&& rhs) {
+    return {ExpressionOf<R>::Make(std::forward<R>(rhs)), ScaleBy{scalar}};
+}
+
 Matrix operator/(double scalar, const Matrix& rhs);
 
-Matrix operator+(const Matrix& lhs, double scalar);
-Matrix operator-(const Matrix& lhs, double scalar);
-Matrix operator*(const Matrix& lhs, double scalar);
-Matrix operator/(const Matrix& lhs, double scalar);
+template <typename L, typename = EnableIfOperand<L>>
+ElementwiseMap<ExpressionType<L>, ShiftBy> operator+(L&& lhs, double scalar) {
+    return {ExpressionOf<L>::Make(std::forward<L>(lhs)), ShiftBy{scalar}};
+}
+
+template <typename L, typename = EnableIfOperand<L>>
+ElementwiseMap<ExpressionType<L>, ShiftBy> operator-(L&& lhs, double scalar) {
+    return {ExpressionOf<L>::Make(std::forward<L>(lhs)), ShiftBy{-scalar}};
+}
+
+template <typename L, typename = EnableIfOperand<L>>
+ElementwiseMap<ExpressionType<L>, ScaleBy> operator*(L&& lhs, double scalar) {
+    return {ExpressionOf<L>::Make(std::forward<L>(lhs)), ScaleBy{scalar}};
+}
+
+template <typename L, typename = EnableIfOperand<L>>
+ElementwiseMap<ExpressionType<L>, ScaleBy> operator/(L&& lhs, double scalar) {
+    return {ExpressionOf<L>::Make(std::forward<L>(lhs)), ScaleBy{1.0 / scalar}};
+}
+
+/// @brief lhs += expression, fused into one pass over lhs.
+template <typename E>
+Matrix& operator+=(Matrix& lhs, const MatrixExpression<E>& rhs) {
+    ElementwiseBinary<MatrixRef, E, PlusOp>(MatrixRef(lhs), rhs.Self()).AssignTo(lhs.Data());
+    return lhs;
+}
+
+/// @brief lhs -= expression, fused into one pass over lhs.
+template <typename E>
+Matrix& operator-=(Matrix& lhs, const MatrixExpression<E>& rhs) {
+    ElementwiseBinary<MatrixRef, E, MinusOp>(MatrixRef(lhs), rhs.Self()).AssignTo(lhs.Data());
+    return lhs;
+}
+
+template <typename E>
+std::ostream& operator<<(std::ostream& os, const MatrixExpression<E>& expression) {
+    return os << expression.Self().Eval();
+}
+
 }  // namespace matrix
 }  // namespace math_cpp
 
@@ -0,0 +1,168 @@
+/// @file matrix_preconditioner.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_preconditioner.h"
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace math_cpp {
+namespace matrix {
+
+namespace {
+/// Lower triangular factor in CSR, the diagonal is the last element of every row.
+struct LowerFactor {
+    std::vector<std::size_t> offsets{};
+    std::vector<std::size_t> indices{};
+    std::vector<double> values{};
+};
+
+Preconditioner MakeDiagonalPreconditioner(std::vector<double> diagonal) {
+    for (auto& value : diagonal) {
+        if (value == 0.0) {
+            throw std::invalid_argument("diagonal should be non-zero");
+        }
+        value = 1.0 / value;
+    }
+    // Shared, copies of the std::function do not copy the diagonal.
+    auto inverse = std::make_shared<const std::vector<double>>(std::move(diagonal));
+    return [inverse](const ConstMatrixView& r, const MatrixView& z) {
+        const std::vector<double>& d = *inverse;
+        for (std::size_t i = 0; i < d.size(); ++i) {
+            z.AtUnchecked(i, 0) = d[i] * r.AtUnchecked(i, 0);
+        }
+    };
+}
+
+/// Copies the lower triangle of a CSR matrix, checking that every row has its diagonal.
+LowerFactor LowerTriangle(const SparseMatrix& csr) {
+    LowerFactor factor;
+    factor.offsets.reserve(csr.Row() + 1);
+    factor.offsets.push_back(0);
+    for (std::size_t r = 0; r < csr.Row(); ++r) {
+        bool has_diagonal = false;
+        for (std::size_t k = csr.Offsets()[r]; k < csr.Offsets()[r + 1]; ++k) {
+            const std::size_t c = csr.Indices()[k];
+            if (c > r) {
+                break;
+            }
+            has_diagonal = (c == r);
+            factor.indices.push_back(c);
+            factor.values.push_back(csr.Values()[k]);
+        }
+        if (!has_diagonal) {
+            throw std::invalid_argument("diagonal should be non-zero");
+        }
+        factor.offsets.push_back(factor.indices.size());
+    }
+    return factor;
+}
+
+/// Row by row IC(0), L(i, k) = (A(i, k) - sum_j L(i, j) * L(k, j)) / L(k, k) over the shared pattern j < k.
+void FactorizeInPlace(LowerFactor& factor) {
+    const std::size_t n = factor.offsets.size() - 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t row_begin = factor.offsets[i];
+        const std::size_t diagonal = factor.offsets[i + 1] - 1;
+        for (std::size_t p = row_begin; p < diagonal; ++p) {
+            const std::size_t k = factor.indices[p];
+            // Both patterns are sorted, the sum over their intersection is a merge.
+            double sum = factor.values[p];
+            std::size_t a = row_begin;
+            std::size_t b = factor.offsets[k];
+            const std::size_t k_diagonal = factor.offsets[k + 1] - 1;
+            while ((a < p) && (b < k_diagonal)) {
+                if (factor.indices[a] == factor.indices[b]) {
+                    sum -= factor.values[a++] * factor.values[b++];
+                } else if (factor.indices[a] < factor.indices[b]) {
+                    ++a;
+                } else {
+                    ++b;
+                }
+            }
+            factor.values[p] = sum / factor.values[k_diagonal];
+        }
+
+        double pivot = factor.values[diagonal];
+        for (std::size_t p = row_begin; p < diagonal; ++p) {
+            pivot -= factor.values[p] * factor.values[p];
+        }
+        if (!(pivot > 0.0)) {
+            throw std::invalid_argument("incomplete Cholesky broke down, matrix should be positive definite");
+        }
+        factor.values[diagonal] = std::sqrt(pivot);
+    }
+}
+}  // namespace
+
+Preconditioner MakeJacobiPreconditioner(const Matrix& mat) {
+    if (mat.Row() != mat.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+    std::vector<double> diagonal(mat.Row());
+    for (std::size_t i = 0; i < mat.Row(); ++i) {
+        diagonal[i] = mat.AtUnchecked(i, i);
+    }
+    return MakeDiagonalPreconditioner(std::move(diagonal));
+}
+
+Preconditioner MakeJacobiPreconditioner(const SparseMatrix& mat) {
+    if (mat.Row() != mat.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+    std::vector<double> diagonal(mat.Row());
+    for (std::size_t i = 0; i < mat.Row(); ++i) {
+        diagonal[i] = mat.At(i, i);
+    }
+    return MakeDiagonalPreconditioner(std::move(diagonal));
+}
+
+Preconditioner MakeIncompleteCholeskyPreconditioner(const SparseMatrix& mat) {
+    if (mat.Row() != mat.Col()) {
+        throw std::invalid_argument("matrix should be square");
+    }
+    const SparseMatrix csr =
+        (mat.GetFormat() == SparseMatrix::Format::kCSR) ? mat : mat.ToFormat(SparseMatrix::Format::kCSR);
+    auto factor = std::make_shared<LowerFactor>(LowerTriangle(csr));
+    FactorizeInPlace(*factor);
+
+    std::shared_ptr<const LowerFactor> l = factor;
+    return [l](const ConstMatrixView& r, const MatrixView& z) {
+        const std::size_t n = l->offsets.size() - 1;
+        // L * y = r, y is kept in z.
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t diagonal = l->offsets[i + 1] - 1;
+            double sum = r.AtUnchecked(i, 0);
+            for (std::size_t p = l->offsets[i]; p < diagonal; ++p) {
+                sum -= l->values[p] * z.AtUnchecked(l->indices[p], 0);
+            }
+            z.AtUnchecked(i, 0) = sum / l->values[diagonal];
+        }
+        // L^T * z = y, L is walked by rows, so every solved z(i) is scattered into the rows above it.
+        for (std::size_t i = n; i-- > 0;) {
+            const std::size_t diagonal = l->offsets[i + 1] - 1;
+            const double value = z.AtUnchecked(i, 0) / l->values[diagonal];
+            z.AtUnchecked(i, 0) = value;
+            for (std::size_t p = l->offsets[i]; p < diagonal; ++p) {
+                z.AtUnchecked(l->indices[p], 0) -= l->values[p] * value;
+            }
+        }
+    };
+}
+
+Preconditioner MakeIncompleteCholeskyPreconditioner(const Matrix& mat) {
+    return MakeIncompleteCholeskyPreconditioner(SparseMatrix(mat));
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,41 @@
+/// @file matrix_preconditioner.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Preconditioners for the Krylov solvers.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_PRECONDITIONER_H_
+#define SRC_MATRIX_MATRIX_PRECONDITIONER_H_
+
+#include <functional>
+
+#include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_sparse.h"
+#include "src/matrix/matrix_view.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Computes z = M^-1 * r for n x 1 views r and z, where M approximates A and is cheap to invert. r never
+/// aliases z. An empty Preconditioner means M = I.
+using Preconditioner = std::function<void(const ConstMatrixView& r, const MatrixView& z)>;
+
+/// @brief M = diag(A). Cheap, helps when the diagonal dominates or the rows are badly scaled. Throws on a zero
+/// diagonal.
+Preconditioner MakeJacobiPreconditioner(const Matrix& mat);
+Preconditioner MakeJacobiPreconditioner(const SparseMatrix& mat);
+
+/// @brief M = L * L^T with L the incomplete Cholesky factor IC(0): Cholesky restricted to the non-zero pattern of the
+/// lower triangle of A, so L is as sparse as A. For symmetric positive definite A, only the lower triangle is read.
+/// Throws when a pivot is not positive, which can happen for positive definite A that is far from diagonally dominant.
+Preconditioner MakeIncompleteCholeskyPreconditioner(const SparseMatrix& mat);
+/// @brief IC(0) of the non-zero elements of a dense matrix. A fully dense A gives the exact Cholesky factor.
+Preconditioner MakeIncompleteCholeskyPreconditioner(const Matrix& mat);
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_PRECONDITIONER_H_
@@ -0,0 +1,292 @@
+/// @file matrix_qr_solver.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_qr_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "src/matrix/matrix_kernel.h"
+#include "src/matrix/matrix_simd.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+
+namespace {
+// Reflectors per compact WY panel.
+constexpr std::size_t kBlock = 32;
+}  // namespace
+
+QRSolver::QRSolver(const Matrix& mat, Pivoting pivoting)
+    : qr_(mat), tau_(std::min(mat.Row(), mat.Col())), permutation_(mat.Col()), pivoting_(pivoting) {
+    std::iota(std::begin(permutation_), std::end(permutation_), 0);
+    if (pivoting_ == Pivoting::kColumn) {
+        FactorizePivoted();
+    } else {
+        Factorize();
+    }
+}
+
+void QRSolver::Factorize() {
+    const std::size_t m = qr_.Row();
+    const std::size_t n = qr_.Col();
+    const std::size_t k = std::min(m, n);
+    for (std::size_t start = 0; start < k; start += kBlock) {
+        const std::size_t width = std::min(kBlock, k - start);
+        const std::size_t end = start + width;
+        for (std::size_t j = start; j < end; ++j) {
+            Reflect(j, end);
+        }
+        AddPanel(start, width);
+        if (end == n) {
+            break;
+        }
+
+        // A2 = (I - V * T^T * V^T) * A2
+        ApplyPanel(blocks_.size() - 1, true, qr_.Block(start, end, m - start, n - end));
+    }
+}
+
+void QRSolver::FactorizePivoted() {
+    const std::size_t m = qr_.Row();
+    const std::size_t n = qr_.Col();
+    const std::size_t k = std::min(m, n);
+    double* data = qr_.Data();
+
+    // Norms of the columns below the current row, downdated after each step and recomputed when cancellation makes
+    // the downdate unreliable (the LAPACK xGEQP3 rule).
+    memory::Vector<double> norms(n);
+    for (std::size_t r = 0; r < m; ++r) {
+        for (std::size_t c = 0; c < n; ++c) {
+            norms[c] += data[r * n + c] * data[r * n + c];
+        }
+    }
+    for (auto& norm : norms) {
+        norm = std::sqrt(norm);
+    }
+    memory::Vector<double> reference = norms;
+    const double recompute = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    for (std::size_t j = 0; j < k; ++j) {
+        const std::size_t pivot = static_cast<std::size_t>(
+            std::distance(std::begin(norms), std::max_element(std::begin(norms) + j, std::end(norms))));
+        if (pivot != j) {
+            for (std::size_t r = 0; r < m; ++r) {
+                std::swap(data[r * n + j], data[r * n + pivot]);
+            }
+            std::swap(permutation_[j], permutation_[pivot]);
+            std::swap(norms[j], norms[pivot]);
+            std::swap(reference[j], reference[pivot]);
+        }
+
+        Reflect(j, n);
+
+        for (std::size_t c = j + 1; c < n; ++c) {
+            if (norms[c] == 0.0) {
+                continue;
+            }
+            const double ratio = std::abs(data[j * n + c]) / norms[c];
+            const double remain = std::max(0.0, (1.0 + ratio) * (1.0 - ratio));
+            const double drift = remain * (norms[c] / reference[c]) * (norms[c] / reference[c]);
+            if (drift <= recompute) {
+                double sum = 0.0;
+                for (std::size_t r = j + 1; r < m; ++r) {
+                    sum += data[r * n + c] * data[r * n + c];
+                }
+                norms[c] = std::sqrt(sum);
+                reference[c] = norms[c];
+            } else {
+                norms[c] *= std::sqrt(remain);
+            }
+        }
+    }
+
+    for (std::size_t start = 0; start < k; start += kBlock) {
+        AddPanel(start, std::min(kBlock, k - start));
+    }
+}
+
+void QRSolver::Reflect(std::size_t j, std::size_t col_end) {
+    const std::size_t m = qr_.Row();
+    const std::size_t n = qr_.Col();
+    double* data = qr_.Data();
+
+    // H = I - tau * v * v^T with v(0) = 1 maps column j to (beta, 0, ..., 0). v(0) stays 1 while H is applied and is
+    // replaced by beta afterwards.
+    const MatrixView v = qr_.Block(j, j, m - j, 1);
+    double tau = 0.0;
+    const double beta = kernel::MakeReflector(v, tau);
+    tau_[j] = tau;
+
+    const std::size_t width = col_end - j - 1;
+    if ((tau != 0.0) && (width > 0)) {
+        // A -= tau * v * w^T with w = A(j.., j + 1..col_end)^T * v
+        const MatrixView rest = qr_.Block(j, j + 1, m - j, width);
+        memory::Vector<double> w(width);
+        kernel::MultiplyTransposed(rest, v, MatrixView(w.data(), width, 1, 1, 1));
+        const double* w_data = w.data();
+        parallel::ParallelFor(j, m, width, [=](std::size_t first, std::size_t last) {
+            for (std::size_t r = first; r < last; ++r) {
+                simd::Axpy(-tau * data[r * n + j], w_data, data + r * n + j + 1, width);
+            }
+        });
+    }
+    data[j * n + j] = beta;
+}
+
+Matrix QRSolver::PanelVectors(std::size_t start, std::size_t width) const {
+    const std::size_t rows = qr_.Row() - start;
+    Matrix v(rows, width);
+    for (std::size_t c = 0; c < width; ++c) {
+        v.AtUnchecked(c, c) = 1.0;
+    }
+    parallel::ParallelFor(1, rows, width, [&](std::size_t first, std::size_t last) {
+        for (std::size_t r = first; r < last; ++r) {
+            const std::size_t below = std::min(r, width);
+            std::copy(qr_.Data() + (start + r) * qr_.Col() + start,
+                      qr_.Data() + (start + r) * qr_.Col() + start + below, v.Data() + r * width);
+        }
+    });
+    return v;
+}
+
+Matrix QRSolver::BlockFactor(std::size_t start, std::size_t width) const {
+    Matrix t(width, width);
+    kernel::HouseholderBlockFactor(PanelVectors(start, width), tau_.data() + start, t);
+    return t;
+}
+
+void QRSolver::AddPanel(std::size_t start, std::size_t width) {
+    Matrix head(width, width);
+    for (std::size_t r = 0; r < width; ++r) {
+        for (std::size_t c = 0; c < r; ++c) {
+            head.AtUnchecked(r, c) = qr_.AtUnchecked(start + r, start + c);
+        }
+        head.AtUnchecked(r, r) = 1.0;
+    }
+    heads_.push_back(std::move(head));
+    blocks_.push_back(BlockFactor(start, width));
+}
+
+void QRSolver::ApplyPanel(std::size_t p, bool transpose, const MatrixView& b) const {
+    const std::size_t start = p * kBlock;
+    const std::size_t width = heads_[p].Row();
+    const ConstMatrixView tail = qr_.Block(start + width, start, qr_.Row() - start - width, width);
+    kernel::ApplyBlockReflector(heads_[p], tail, blocks_[p], transpose, b);
+}
+
+void QRSolver::ApplyQTranspose(const MatrixView& b) const {
+    const std::size_t m = qr_.Row();
+    if (b.Row() != m) {
+        throw std::invalid_argument("check size, b should have as many rows as the matrix");
+    }
+    for (std::size_t p = 0; p < blocks_.size(); ++p) {
+        const std::size_t start = p * kBlock;
+        ApplyPanel(p, true, b.Block(start, 0, m - start, b.Col()));
+    }
+}
+
+void QRSolver::ApplyQ(const MatrixView& b) const {
+    const std::size_t m = qr_.Row();
+    if (b.Row() != m) {
+        throw std::invalid_argument("check size, b should have as many rows as the matrix");
+    }
+    for (std::size_t p = blocks_.size(); p-- > 0;) {
+        const std::size_t start = p * kBlock;
+        ApplyPanel(p, false, b.Block(start, 0, m - start, b.Col()));
+    }
+}
+
+Matrix QRSolver::Q() const {
+    const std::size_t k = std::min(qr_.Row(), qr_.Col());
+    Matrix q(qr_.Row(), k);
+    for (std::size_t i = 0; i < k; ++i) {
+        q.AtUnchecked(i, i) = 1.0;
+    }
+    ApplyQ(q);
+    return q;
+}
+
+Matrix QRSolver::R() const {
+    const std::size_t k = std::min(qr_.Row(), qr_.Col());
+    Matrix r(k, qr_.Col());
+    for (std::size_t i = 0; i < k; ++i) {
+        for (std::size_t c = i; c < qr_.Col(); ++c) {
+            r.AtUnchecked(i, c) = qr_.AtUnchecked(i, c);
+        }
+    }
+    return r;
+}
+
+const memory::Vector<std::size_t>& QRSolver::Permutation() const { return permutation_; }
+
+std::size_t QRSolver::Rank(double tolerance) const {
+    const std::size_t k = std::min(qr_.Row(), qr_.Col());
+    if (k == 0) {
+        return 0;
+    }
+    if (tolerance < 0.0) {
+        double largest = 0.0;
+        for (std::size_t i = 0; i < k; ++i) {
+            largest = std::max(largest, std::abs(qr_.AtUnchecked(i, i)));
+        }
+        tolerance = static_cast<double>(std::max(qr_.Row(), qr_.Col())) * std::numeric_limits<double>::epsilon() *
+                    largest;
+    }
+    std::size_t rank = 0;
+    for (std::size_t i = 0; i < k; ++i) {
+        if (std::abs(qr_.AtUnchecked(i, i)) > tolerance) {
+            ++rank;
+        }
+    }
+    return rank;
+}
+
+Matrix QRSolver::SolveLeastSquares(const Matrix& b) const {
+    const std::size_t n = qr_.Col();
+    std::size_t rank = n;
+    if (pivoting_ == Pivoting::kColumn) {
+        rank = Rank();
+    } else {
+        if (qr_.Row() < n) {
+            throw std::invalid_argument("least squares without pivoting needs at least as many rows as columns");
+        }
+        if (Rank() < n) {
+            throw std::invalid_argument("matrix is rank deficient, use column pivoting");
+        }
+    }
+
+    Matrix y = b;
+    ApplyQTranspose(y);
+
+    // R11 * z = (Q^T * b)(0..rank), then x = P * [z; 0].
+    Matrix z(rank, b.Col());
+    kernel::Copy(y.Block(0, 0, rank, b.Col()), z);
+    for (std::size_t i = rank; i-- > 0;) {
+        for (std::size_t l = i + 1; l < rank; ++l) {
+            kernel::Axpy(-qr_.AtUnchecked(i, l), z.RowView(l), z.RowView(i));
+        }
+        kernel::Scale(1.0 / qr_.AtUnchecked(i, i), z.RowView(i));
+    }
+
+    Matrix x(n, b.Col());
+    for (std::size_t j = 0; j < rank; ++j) {
+        kernel::Copy(z.RowView(j), x.RowView(permutation_[j]));
+    }
+    return x;
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
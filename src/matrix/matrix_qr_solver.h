@@ -0,0 +1,89 @@
+/// @file matrix_qr_solver.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Householder QR decomposition and least squares.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_QR_SOLVER_H_
+#define SRC_MATRIX_MATRIX_QR_SOLVER_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_view.h"
+#include "src/memory/allocator.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Factors an m x n matrix as A * P = Q * R with Householder reflectors. Q is orthogonal and kept implicitly as
+/// the reflectors below the diagonal, R is upper trapezoidal and P is the identity unless column pivoting is asked.
+/// Reflectors are grouped by panels of 32 in compact WY form, I - V * T * V^T, so applying them to the rest of A or to
+/// a right hand side is three GEMMs. Least squares through QR keeps the condition number of A, the normal equations
+/// A^T * A * x = A^T * b square it.
+class QRSolver {
+ public:
+    enum class Pivoting {
+        kNone,
+        /// Moves the column with the largest remaining norm to the front at every step, so |R(i, i)| is non-increasing
+        /// and the rank can be read from the diagonal. The column choice makes the factorization unblocked, only Q^T
+        /// and Q products stay blocked.
+        kColumn,
+    };
+
+    explicit QRSolver(const Matrix& mat, Pivoting pivoting = Pivoting::kNone);
+
+    /// @brief x minimizing |A * x - b| for every column of b. b is m x r, x is n x r.
+    /// Without pivoting A must have full column rank (m >= n), otherwise it throws. With pivoting a rank deficient A
+    /// gives the basic solution that is zero on the pivoted columns Rank() .. n - 1.
+    Matrix SolveLeastSquares(const Matrix& b) const;
+
+    /// @brief b = Q^T * b for an m x r view, with the full m x m Q.
+    void ApplyQTranspose(const MatrixView& b) const;
+    /// @brief b = Q * b for an m x r view, with the full m x m Q.
+    void ApplyQ(const MatrixView& b) const;
+
+    /// @brief Thin factor, m x min(m, n) with orthonormal columns.
+    Matrix Q() const;
+    /// @brief min(m, n) x n upper trapezoidal factor.
+    Matrix R() const;
+    /// @brief Column j of A * P is column Permutation()[j] of A.
+    const memory::Vector<std::size_t>& Permutation() const;
+
+    /// @brief Diagonal elements of R above tolerance in magnitude. A negative tolerance selects
+    /// max(m, n) * epsilon * max |R(i, i)|. Reliable with column pivoting, without it a small R(i, i) proves rank
+    /// deficiency but a rank deficient A does not always show one.
+    std::size_t Rank(double tolerance = -1.0) const;
+
+ private:
+    void Factorize();
+    void FactorizePivoted();
+    /// Reflector of column j from row j down, applied to columns j + 1 .. col_end.
+    void Reflect(std::size_t j, std::size_t col_end);
+    /// T of the panel starting at column start, I - V * T * V^T = H(start) * ... * H(start + width - 1).
+    Matrix BlockFactor(std::size_t start, std::size_t width) const;
+    /// Explicit unit lower trapezoidal V of the panel starting at column start.
+    Matrix PanelVectors(std::size_t start, std::size_t width) const;
+    /// Appends the head and T of the panel starting at column start.
+    void AddPanel(std::size_t start, std::size_t width);
+    /// b = (I - V * T * V^T) * b for panel p, or with T^T when transpose is set. V is read from qr_ below the head.
+    void ApplyPanel(std::size_t p, bool transpose, const MatrixView& b) const;
+
+    Matrix qr_{};
+    memory::Vector<double> tau_{};
+    memory::Vector<std::size_t> permutation_{};
+    /// T of panel p, upper triangular.
+    std::vector<Matrix> blocks_{};
+    /// Top width x width rows of V of panel p with explicit ones and zeros, the rows below are read from qr_.
+    std::vector<Matrix> heads_{};
+    Pivoting pivoting_;
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_QR_SOLVER_H_
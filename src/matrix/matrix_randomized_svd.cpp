@@ -0,0 +1,90 @@
+/// @file matrix_randomized_svd.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_randomized_svd.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "src/matrix/matrix_kernel.h"
+#include "src/matrix/matrix_qr_solver.h"
+#include "src/matrix/matrix_svd_solver.h"
+#include "src/random/random.h"
+
+namespace math_cpp {
+namespace matrix {
+
+namespace {
+Matrix Orthonormalize(const Matrix& mat) { return QRSolver(mat).Q(); }
+}  // namespace
+
+RandomizedSVD::RandomizedSVD(const Matrix& mat, std::size_t rank, std::size_t oversampling,
+                             std::size_t power_iterations) {
+    Solve(mat, rank, random::Random::GetInstance(), oversampling, power_iterations);
+}
+
+RandomizedSVD::RandomizedSVD(const Matrix& mat, std::size_t rank, random::Random& generator, std::size_t oversampling,
+                             std::size_t power_iterations) {
+    Solve(mat, rank, generator, oversampling, power_iterations);
+}
+
+void RandomizedSVD::Solve(const Matrix& mat, std::size_t rank, random::Random& generator, std::size_t oversampling,
+                          std::size_t power_iterations) {
+    const std::size_t m = mat.Row();
+    const std::size_t n = mat.Col();
+    if ((rank == 0) || (rank > std::min(m, n))) {
+        throw std::invalid_argument("check rank, it should be 1 <= rank <= min(row, col)");
+    }
+    const std::size_t l = std::min(rank + oversampling, std::min(m, n));
+
+    // Range finder: Q spans A * Omega, refined by (A * A^T)^q.
+    Matrix y(m, l);
+    kernel::Gemm(1.0, mat, Matrix::Random(n, l, generator), 0.0, y);
+    Matrix q = Orthonormalize(y);
+    Matrix z(n, l);
+    for (std::size_t iteration = 0; iteration < power_iterations; ++iteration) {
+        kernel::Gemm(1.0, mat.View().Transpose(), q, 0.0, z);
+        kernel::Gemm(1.0, mat, Orthonormalize(z), 0.0, y);
+        q = Orthonormalize(y);
+    }
+
+    // SVD of the small B = Q^T * A.
+    Matrix b(l, n);
+    kernel::Gemm(1.0, q.View().Transpose(), mat, 0.0, b);
+    SVDSolver small(b);
+
+    singular_values_ = Matrix(rank, 1);
+    kernel::Copy(small.SingularValues().Block(0, 0, rank, 1), singular_values_);
+    v_transpose_ = Matrix(rank, n);
+    kernel::Copy(small.VTranspose().Block(0, 0, rank, n), v_transpose_);
+    u_ = Matrix(m, rank);
+    kernel::Gemm(1.0, q, small.U().Block(0, 0, l, rank), 0.0, u_);
+}
+
+Matrix RandomizedSVD::U() const { return u_; }
+
+Matrix RandomizedSVD::SingularValues() const { return singular_values_; }
+
+Matrix RandomizedSVD::VTranspose() const { return v_transpose_; }
+
+Matrix RandomizedSVD::LowRankApproximation() const {
+    Matrix scaled = u_;
+    for (std::size_t r = 0; r < scaled.Row(); ++r) {
+        for (std::size_t c = 0; c < scaled.Col(); ++c) {
+            scaled(r, c) *= singular_values_(c, 0);
+        }
+    }
+    Matrix result(u_.Row(), v_transpose_.Col());
+    kernel::Gemm(1.0, scaled, v_transpose_, 0.0, result);
+    return result;
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,56 @@
+/// @file matrix_randomized_svd.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Truncated SVD by randomized range finding.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_RANDOMIZED_SVD_H_
+#define SRC_MATRIX_MATRIX_RANDOMIZED_SVD_H_
+
+#include <cstddef>
+
+#include "src/matrix/matrix_core.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Rank k approximation A ~ U * diag(S) * V^T of an m x n matrix (Halko, Martinsson and Tropp).
+/// A is multiplied by a Gaussian n x l sketch, l = k + oversampling, and the product is orthonormalized into a basis Q
+/// of the dominant range of A. Every power iteration multiplies by A^T and A once more, which sharpens the basis when
+/// the singular values decay slowly. SVDSolver on the small l x n matrix Q^T * A then gives the factors. The work is a
+/// few GEMMs with l columns, O(m * n * l) in total.
+class RandomizedSVD {
+ public:
+    /// @param rank k, 1 <= k <= min(m, n).
+    /// @param oversampling Extra sketch columns, the error of the first k singular values shrinks quickly with them.
+    /// @param power_iterations Products with A^T * A applied to the sketch, each one reorthonormalized.
+    RandomizedSVD(const Matrix& mat, std::size_t rank, std::size_t oversampling = 10, std::size_t power_iterations = 2);
+    /// @brief Draws the sketch from generator instead of the thread generator, for reproducible factors.
+    RandomizedSVD(const Matrix& mat, std::size_t rank, random::Random& generator, std::size_t oversampling = 10,
+                  std::size_t power_iterations = 2);
+
+    /// @brief m x k with orthonormal columns.
+    Matrix U() const;
+    /// @brief k x 1 in descending order.
+    Matrix SingularValues() const;
+    /// @brief k x n with orthonormal rows.
+    Matrix VTranspose() const;
+    /// @brief U * diag(S) * V^T, m x n.
+    Matrix LowRankApproximation() const;
+
+ private:
+    void Solve(const Matrix& mat, std::size_t rank, random::Random& generator, std::size_t oversampling,
+               std::size_t power_iterations);
+
+    Matrix u_{};
+    Matrix singular_values_{};
+    Matrix v_transpose_{};
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_RANDOMIZED_SVD_H_
@@ -0,0 +1,495 @@
+/// @file matrix_simd.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_simd.h"
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MATH_CPP_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace math_cpp {
+namespace matrix {
+namespace simd {
+
+namespace {
+
+struct KernelTable {
+    void (*add)(const double*, const double*, double*, std::size_t);
+    void (*sub)(const double*, const double*, double*, std::size_t);
+    void (*scale)(double, const double*, double*, std::size_t);
+    void (*axpy)(double, const double*, double*, std::size_t);
+    void (*abs)(const double*, double*, std::size_t);
+    double (*dot)(const double*, const double*, std::size_t);
+    double (*sum_squares)(const double*, std::size_t);
+    void (*gemm_tile_4x8)(std::size_t, const double*, const double*, double*);
+    void (*transpose_4x4)(const double*, std::size_t, double*, std::size_t);
+};
+
+// Scalar kernels. They are also used for the tails of the vector kernels.
+
+void AddScalar(const double* a, const double* b, double* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+void SubScalar(const double* a, const double* b, double* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+void ScaleScalar(double alpha, const double* x, double* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = alpha * x[i];
+    }
+}
+
+void AxpyScalar(double alpha, const double* x, double* y, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+void AbsScalar(const double* x, double* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = std::abs(x[i]);
+    }
+}
+
+double DotScalar(const double* a, const double* b, std::size_t n) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+double SumSquaresScalar(const double* x, std::size_t n) { return DotScalar(x, x, n); }
+
+void GemmTile4x8Scalar(std::size_t kc, const double* a, const double* b, double* acc) {
+    for (std::size_t p = 0; p < kc; ++p) {
+        for (std::size_t i = 0; i < 4; ++i) {
+            for (std::size_t j = 0; j < 8; ++j) {
+                acc[i * 8 + j] += a[i] * b[j];
+            }
+        }
+        a += 4;
+        b += 8;
+    }
+}
+
+void Transpose4x4Scalar(const double* src, std::size_t src_stride, double* dst, std::size_t dst_stride) {
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            dst[j * dst_stride + i] = src[i * src_stride + j];
+        }
+    }
+}
+
+constexpr KernelTable kScalarTable{AddScalar,         SubScalar,         ScaleScalar, AxpyScalar, AbsScalar,
+                                   DotScalar,         SumSquaresScalar,  GemmTile4x8Scalar,
+                                   Transpose4x4Scalar};
+
+#ifdef MATH_CPP_SIMD_X86
+
+// SSE2 kernels, 2 doubles per register.
+
+__attribute__((target("sse2"))) void AddSSE2(const double* a, const double* b, double* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    }
+    AddScalar(a + i, b + i, out + i, n - i);
+}
+
+__attribute__((target("sse2"))) void SubSSE2(const double* a, const double* b, double* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(out + i, _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    }
+    SubScalar(a + i, b + i, out + i, n - i);
+}
+
+__attribute__((target("sse2"))) void ScaleSSE2(double alpha, const double* x, double* out, std::size_t n) {
+    const __m128d va = _mm_set1_pd(alpha);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(out + i, _mm_mul_pd(va, _mm_loadu_pd(x + i)));
+    }
+    ScaleScalar(alpha, x + i, out + i, n - i);
+}
+
+__attribute__((target("sse2"))) void AxpySSE2(double alpha, const double* x, double* y, std::size_t n) {
+    const __m128d va = _mm_set1_pd(alpha);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(va, _mm_loadu_pd(x + i))));
+    }
+    AxpyScalar(alpha, x + i, y + i, n - i);
+}
+
+__attribute__((target("sse2"))) void AbsSSE2(const double* x, double* out, std::size_t n) {
+    const __m128d sign = _mm_set1_pd(-0.0);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(out + i, _mm_andnot_pd(sign, _mm_loadu_pd(x + i)));
+    }
+    AbsScalar(x + i, out + i, n - i);
+}
+
+__attribute__((target("sse2"))) double DotSSE2(const double* a, const double* b, std::size_t n) {
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+    }
+    const __m128d sum = _mm_add_pd(sum0, sum1);
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum))) + DotScalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("sse2"))) double SumSquaresSSE2(const double* x, std::size_t n) { return DotSSE2(x, x, n); }
+
+/// Four 2 x 2 transposes, each is a pair of unpacks.
+__attribute__((target("sse2"))) void Transpose4x4SSE2(const double* src, std::size_t src_stride, double* dst,
+                                                      std::size_t dst_stride) {
+    for (std::size_t i = 0; i < 4; i += 2) {
+        for (std::size_t j = 0; j < 4; j += 2) {
+            const __m128d r0 = _mm_loadu_pd(src + i * src_stride + j);
+            const __m128d r1 = _mm_loadu_pd(src + (i + 1) * src_stride + j);
+            _mm_storeu_pd(dst + j * dst_stride + i, _mm_unpacklo_pd(r0, r1));
+            _mm_storeu_pd(dst + (j + 1) * dst_stride + i, _mm_unpackhi_pd(r0, r1));
+        }
+    }
+}
+
+/// In-register 4 x 4 transpose, unpacks within 128-bit lanes then swaps the lanes. Only needs AVX, so the AVX-512
+/// table uses it too.
+__attribute__((target("avx"))) void Transpose4x4AVX(const double* src, std::size_t src_stride, double* dst,
+                                                    std::size_t dst_stride) {
+    const __m256d r0 = _mm256_loadu_pd(src);
+    const __m256d r1 = _mm256_loadu_pd(src + src_stride);
+    const __m256d r2 = _mm256_loadu_pd(src + 2 * src_stride);
+    const __m256d r3 = _mm256_loadu_pd(src + 3 * src_stride);
+    const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+    _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(dst + dst_stride, _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(dst + 2 * dst_stride, _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(dst + 3 * dst_stride, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+// AVX2 kernels, 4 doubles per register. FMA is always available together with AVX2 on the CPUs we select this for.
+
+__attribute__((target("avx2,fma"))) void AddAVX2(const double* a, const double* b, double* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    }
+    AddScalar(a + i, b + i, out + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void SubAVX2(const double* a, const double* b, double* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    }
+    SubScalar(a + i, b + i, out + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void ScaleAVX2(double alpha, const double* x, double* out, std::size_t n) {
+    const __m256d va = _mm256_set1_pd(alpha);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(va, _mm256_loadu_pd(x + i)));
+    }
+    ScaleScalar(alpha, x + i, out + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void AxpyAVX2(double alpha, const double* x, double* y, std::size_t n) {
+    const __m256d va = _mm256_set1_pd(alpha);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+    }
+    AxpyScalar(alpha, x + i, y + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void AbsAVX2(const double* x, double* out, std::size_t n) {
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_andnot_pd(sign, _mm256_loadu_pd(x + i)));
+    }
+    AbsScalar(x + i, out + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) double HorizontalSumAVX2(__m256d v) {
+    const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+__attribute__((target("avx2,fma"))) double DotAVX2(const double* a, const double* b, std::size_t n) {
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        sum0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), sum0);
+        sum1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4), sum1);
+    }
+    return HorizontalSumAVX2(_mm256_add_pd(sum0, sum1)) + DotScalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) double SumSquaresAVX2(const double* x, std::size_t n) { return DotAVX2(x, x, n); }
+
+__attribute__((target("avx2,fma"))) void GemmTile4x8AVX2(std::size_t kc, const double* a, const double* b,
+                                                         double* acc) {
+    __m256d c00 = _mm256_loadu_pd(acc + 0), c01 = _mm256_loadu_pd(acc + 4);
+    __m256d c10 = _mm256_loadu_pd(acc + 8), c11 = _mm256_loadu_pd(acc + 12);
+    __m256d c20 = _mm256_loadu_pd(acc + 16), c21 = _mm256_loadu_pd(acc + 20);
+    __m256d c30 = _mm256_loadu_pd(acc + 24), c31 = _mm256_loadu_pd(acc + 28);
+    for (std::size_t p = 0; p < kc; ++p) {
+        const __m256d b0 = _mm256_loadu_pd(b);
+        const __m256d b1 = _mm256_loadu_pd(b + 4);
+        __m256d ai = _mm256_broadcast_sd(a + 0);
+        c00 = _mm256_fmadd_pd(ai, b0, c00);
+        c01 = _mm256_fmadd_pd(ai, b1, c01);
+        ai = _mm256_broadcast_sd(a + 1);
+        c10 = _mm256_fmadd_pd(ai, b0, c10);
+        c11 = _mm256_fmadd_pd(ai, b1, c11);
+        ai = _mm256_broadcast_sd(a + 2);
+        c20 = _mm256_fmadd_pd(ai, b0, c20);
+        c21 = _mm256_fmadd_pd(ai, b1, c21);
+        ai = _mm256_broadcast_sd(a + 3);
+        c30 = _mm256_fmadd_pd(ai, b0, c30);
+        c31 = _mm256_fmadd_pd(ai, b1, c31);
+        a += 4;
+        b += 8;
+    }
+    _mm256_storeu_pd(acc + 0, c00);
+    _mm256_storeu_pd(acc + 4, c01);
+    _mm256_storeu_pd(acc + 8, c10);
+    _mm256_storeu_pd(acc + 12, c11);
+    _mm256_storeu_pd(acc + 16, c20);
+    _mm256_storeu_pd(acc + 20, c21);
+    _mm256_storeu_pd(acc + 24, c30);
+    _mm256_storeu_pd(acc + 28, c31);
+}
+
+// AVX-512 kernels, 8 doubles per register.
+
+__attribute__((target("avx512f"))) void AddAVX512(const double* a, const double* b, double* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_add_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+    }
+    AddScalar(a + i, b + i, out + i, n - i);
+}
+
+__attribute__((target("avx512f"))) void SubAVX512(const double* a, const double* b, double* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+    }
+    SubScalar(a + i, b + i, out + i, n - i);
+}
+
+__attribute__((target("avx512f"))) void ScaleAVX512(double alpha, const double* x, double* out, std::size_t n) {
+    const __m512d va = _mm512_set1_pd(alpha);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_mul_pd(va, _mm512_loadu_pd(x + i)));
+    }
+    ScaleScalar(alpha, x + i, out + i, n - i);
+}
+
+__attribute__((target("avx512f"))) void AxpyAVX512(double alpha, const double* x, double* y, std::size_t n) {
+    const __m512d va = _mm512_set1_pd(alpha);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(va, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+    }
+    AxpyScalar(alpha, x + i, y + i, n - i);
+}
+
+__attribute__((target("avx512f"))) void AbsAVX512(const double* x, double* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_abs_pd(_mm512_loadu_pd(x + i)));
+    }
+    AbsScalar(x + i, out + i, n - i);
+}
+
+__attribute__((target("avx512f"))) double DotAVX512(const double* a, const double* b, std::size_t n) {
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        sum0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), sum0);
+        sum1 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 8), _mm512_loadu_pd(b + i + 8), sum1);
+    }
+    // _mm512_reduce_add_pd trips -Wuninitialized inside the GCC headers, so reduce through memory.
+    std::array<double, 8> lanes{};
+    _mm512_storeu_pd(lanes.data(), _mm512_add_pd(sum0, sum1));
+    return ((lanes[0] + lanes[4]) + (lanes[1] + lanes[5])) + ((lanes[2] + lanes[6]) + (lanes[3] + lanes[7])) +
+           DotScalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx512f"))) double SumSquaresAVX512(const double* x, std::size_t n) {
+    return DotAVX512(x, x, n);
+}
+
+__attribute__((target("avx512f"))) void GemmTile4x8AVX512(std::size_t kc, const double* a, const double* b,
+                                                          double* acc) {
+    __m512d c0 = _mm512_loadu_pd(acc + 0);
+    __m512d c1 = _mm512_loadu_pd(acc + 8);
+    __m512d c2 = _mm512_loadu_pd(acc + 16);
+    __m512d c3 = _mm512_loadu_pd(acc + 24);
+    for (std::size_t p = 0; p < kc; ++p) {
+        const __m512d bp = _mm512_loadu_pd(b);
+        c0 = _mm512_fmadd_pd(_mm512_set1_pd(a[0]), bp, c0);
+        c1 = _mm512_fmadd_pd(_mm512_set1_pd(a[1]), bp, c1);
+        c2 = _mm512_fmadd_pd(_mm512_set1_pd(a[2]), bp, c2);
+        c3 = _mm512_fmadd_pd(_mm512_set1_pd(a[3]), bp, c3);
+        a += 4;
+        b += 8;
+    }
+    _mm512_storeu_pd(acc + 0, c0);
+    _mm512_storeu_pd(acc + 8, c1);
+    _mm512_storeu_pd(acc + 16, c2);
+    _mm512_storeu_pd(acc + 24, c3);
+}
+
+constexpr KernelTable kSSE2Table{AddSSE2, SubSSE2,        ScaleSSE2,         AxpySSE2,        AbsSSE2,
+                                 DotSSE2, SumSquaresSSE2, GemmTile4x8Scalar, Transpose4x4SSE2};
+constexpr KernelTable kAVX2Table{AddAVX2, SubAVX2,        ScaleAVX2,       AxpyAVX2,       AbsAVX2,
+                                 DotAVX2, SumSquaresAVX2, GemmTile4x8AVX2, Transpose4x4AVX};
+constexpr KernelTable kAVX512Table{AddAVX512, SubAVX512,        ScaleAVX512,       AxpyAVX512,     AbsAVX512,
+                                   DotAVX512, SumSquaresAVX512, GemmTile4x8AVX512, Transpose4x4AVX};
+#endif  // MATH_CPP_SIMD_X86
+
+const KernelTable* TableOf(Isa isa) {
+#ifdef MATH_CPP_SIMD_X86
+    switch (isa) {
+        case Isa::kAVX512:
+            return &kAVX512Table;
+        case Isa::kAVX2:
+            return &kAVX2Table;
+        case Isa::kSSE2:
+            return &kSSE2Table;
+        case Isa::kScalar:
+            break;
+    }
+#else
+    static_cast<void>(isa);
+#endif
+    return &kScalarTable;
+}
+
+std::atomic<Isa>& ActiveSlot() {
+    static std::atomic<Isa> active{DetectIsa()};
+    return active;
+}
+
+const KernelTable& Active() { return *TableOf(ActiveSlot().load(std::memory_order_relaxed)); }
+
+}  // namespace
+
+bool IsSupported(Isa isa) {
+    switch (isa) {
+        case Isa::kScalar:
+            return true;
+#ifdef MATH_CPP_SIMD_X86
+        case Isa::kSSE2:
+            return __builtin_cpu_supports("sse2") != 0;
+        case Isa::kAVX2:
+            return (__builtin_cpu_supports("avx2") != 0) && (__builtin_cpu_supports("fma") != 0);
+        case Isa::kAVX512:
+            return __builtin_cpu_supports("avx512f") != 0;
+#else
+        default:
+            return false;
+#endif
+    }
+    return false;
+}
+
+Isa DetectIsa() {
+    static const Isa detected = [] {
+        for (Isa isa : {Isa::kAVX512, Isa::kAVX2, Isa::kSSE2}) {
+            if (IsSupported(isa)) {
+                return isa;
+            }
+        }
+        return Isa::kScalar;
+    }();
+    return detected;
+}
+
+Isa ActiveIsa() { return ActiveSlot().load(std::memory_order_relaxed); }
+
+bool SetIsa(Isa isa) {
+    if (!IsSupported(isa)) {
+        return false;
+    }
+    ActiveSlot().store(isa, std::memory_order_relaxed);
+    return true;
+}
+
+const char* IsaName(Isa isa) {
+    switch (isa) {
+        case Isa::kSSE2:
+            return "SSE2";
+        case Isa::kAVX2:
+            return "AVX2";
+        case Isa::kAVX512:
+            return "AVX-512";
+        case Isa::kScalar:
+            break;
+    }
+    return "Scalar";
+}
+
+void Add(const double* a, const double* b, double* out, std::size_t n) { Active().add(a, b, out, n); }
+
+void Sub(const double* a, const double* b, double* out, std::size_t n) { Active().sub(a, b, out, n); }
+
+void Scale(double alpha, const double* x, double* out, std::size_t n) { Active().scale(alpha, x, out, n); }
+
+void Axpy(double alpha, const double* x, double* y, std::size_t n) { Active().axpy(alpha, x, y, n); }
+
+void Abs(const double* x, double* out, std::size_t n) { Active().abs(x, out, n); }
+
+double Dot(const double* a, const double* b, std::size_t n) { return Active().dot(a, b, n); }
+
+double SumSquares(const double* x, std::size_t n) { return Active().sum_squares(x, n); }
+
+void Transpose4x4(const double* src, std::size_t src_stride, double* dst, std::size_t dst_stride) {
+    Active().transpose_4x4(src, src_stride, dst, dst_stride);
+}
+
+void GemmTile4x8(std::size_t kc, const double* a, const double* b, double* acc) {
+    Active().gemm_tile_4x8(kc, a, b, acc);
+}
+
+}  // namespace simd
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,61 @@
+/// @file matrix_simd.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Elementwise vector kernels dispatched at runtime to the best instruction set of the host CPU.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_SIMD_H_
+#define SRC_MATRIX_MATRIX_SIMD_H_
+
+#include <cstddef>
+
+namespace math_cpp {
+namespace matrix {
+namespace simd {
+
+enum class Isa { kScalar, kSSE2, kAVX2, kAVX512 };
+
+/// @brief Best instruction set supported by the running CPU. Checked with CPUID once.
+Isa DetectIsa();
+
+/// @brief Instruction set used by the kernels below. Defaults to DetectIsa().
+Isa ActiveIsa();
+
+/// @brief Forces the kernels to an instruction set, mainly for testing.
+/// @return false (and keeps the current selection) if the CPU does not support isa.
+bool SetIsa(Isa isa);
+
+bool IsSupported(Isa isa);
+const char* IsaName(Isa isa);
+
+/// out = a + b
+void Add(const double* a, const double* b, double* out, std::size_t n);
+/// out = a - b
+void Sub(const double* a, const double* b, double* out, std::size_t n);
+/// out = alpha * x
+void Scale(double alpha, const double* x, double* out, std::size_t n);
+/// y += alpha * x
+void Axpy(double alpha, const double* x, double* y, std::size_t n);
+/// out = |x|
+void Abs(const double* x, double* out, std::size_t n);
+/// sum(a * b)
+double Dot(const double* a, const double* b, std::size_t n);
+/// sum(x * x)
+double SumSquares(const double* x, std::size_t n);
+
+/// @brief dst = src^T for a 4 x 4 block. Rows of src start src_stride doubles apart, rows of dst dst_stride apart.
+void Transpose4x4(const double* src, std::size_t src_stride, double* dst, std::size_t dst_stride);
+
+/// @brief acc (4 x 8, row-major) += a * b, where a is a packed 4 x kc panel stored column by column and b is a packed
+/// kc x 8 panel stored row by row. Used by the GEMM micro-kernel.
+void GemmTile4x8(std::size_t kc, const double* a, const double* b, double* acc);
+
+}  // namespace simd
+}  // namespace matrix
+}  // namespace math_cpp
+
+#endif  // SRC_MATRIX_MATRIX_SIMD_H_
@@ -10,11 +10,24 @@
 
 #include "src/matrix/matrix_solver.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
 #include <utility>
 
 #include "src/matrix/matrix.h"
+#include "src/matrix/matrix_symmetric_solver.h"
+#include "src/random/random.h"
 namespace math_cpp {
 namespace matrix {
+
+namespace {
+// Power iterations allowed per eigen pair of a non-symmetric matrix.
+constexpr std::size_t kMaxIterations = 1000;
+// |A(r, c) - A(c, r)| relative to the norm of A below which A is treated as symmetric.
+constexpr double kSymmetryTolerance = 1e-12;
+}  // namespace
 EigenSolver::EigenSolver(const Matrix& mat) {
     auto eigen = Solve(mat);
 
@@ -22,6 +35,19 @@ EigenSolver::EigenSolver(const Matrix& mat) {
     eigenvectors_ = eigen.second;
 }
 
+void EigenSolver::Compute(const Matrix& mat, memory::Workspace& workspace) {
+    // Sized before the frame, the results outlive the workspace memory.
+    if ((eigenvalues_.Row() != mat.Row()) || (eigenvectors_.Col() != mat.Col())) {
+        eigenvalues_ = Matrix(mat.Row(), 1);
+        eigenvectors_ = Matrix(mat.Row(), mat.Col());
+    }
+    memory::Workspace::Frame frame(workspace);
+    auto eigen = Solve(mat);
+
+    eigenvalues_ = eigen.first;
+    eigenvectors_ = eigen.second;
+}
+
 Matrix EigenSolver::Eigenvalues() const { return eigenvalues_; }
 
 Matrix EigenSolver::Eigenvectors() const { return eigenvectors_; }
@@ -30,43 +56,93 @@ Matrix EigenSolver::Eigenvectors() const { return eigenvectors_; }
 /// @param mat
 /// @return Pair of eigen values and eigen vectors. first is 1D matrix made by eigen values. second is 2D matrix made by
 /// eigen vectors. Eigen vectors are column vectors, V = [v1, v2, v3 ...]; Eigen values are 1D row vector, E = [e1, e2,
-/// e2 ...];
+/// e2 ...]; Both are ordered by descending absolute eigen value.
 std::pair<Matrix, Matrix> EigenSolver::Solve(const Matrix& mat) {
-    // TODO(sangwon) : to be update
     if (mat.Row() != mat.Col()) {
         throw std::invalid_argument("Eigen should be square matrix");
     }
+    if (IsSymmetric(mat)) {
+        return SolveSymmetric(mat);
+    }
 
-    Matrix result_values(mat.Row(), 1);
-    Matrix result_vectors(mat.Row(), mat.Col());
+    // Power iteration with deflation for non-symmetric input.
+    const std::size_t size = mat.Row();
+    Matrix result_values(size, 1);
+    Matrix result_vectors(size, size);
 
-    Matrix eigen_vector(mat.Row(), 1);
-    Matrix prev(mat.Row(), 1);
+    // Buffers are allocated once, the iterations below only run kernels on them.
+    Matrix eigen_vector(size, 1);
+    Matrix prev(size, 1);
+    Matrix product(size, 1);
     double eps = 1e-5;
     Matrix A = mat;
-    for (std::size_t i = 0; i < mat.Row(); ++i) {
-        eigen_vector = Matrix::Random(mat.Row(), 1);
-        while ((Matrix::Norm2(eigen_vector - prev) > eps)) {
-            prev = eigen_vector;
+    for (std::size_t i = 0; i < size; ++i) {
+        random::FillGaussian(random::Random::GetInstance(), eigen_vector.Data(), size);
+        kernel::Axpy(-1.0, eigen_vector, prev);
+        for (std::size_t iteration = 0; (iteration < kMaxIterations) && (kernel::Norm2(prev) > eps); ++iteration) {
+            kernel::Copy(eigen_vector, prev);
 
             // Prevent negative eigen value effect(?)
             // If there is negative eigen value, then eigen vector flip direction all iterate, and cannot converge.
             // Therefore, doubly multiply A matrix can prevent this effect, because alway positive!
-            eigen_vector = A * A * eigen_vector;
+            kernel::Gemm(1.0, A, eigen_vector, 0.0, product);
+            kernel::Gemm(1.0, A, product, 0.0, eigen_vector);
+
+            kernel::Scale(1.0 / kernel::Norm2(eigen_vector), eigen_vector);
 
-            eigen_vector /= Matrix::Norm2(eigen_vector);
+            // prev becomes the change of this step
+            kernel::Axpy(-1.0, eigen_vector, prev);
         }
+        kernel::Copy(eigen_vector, prev);
 
-        Matrix eigen_vector_T = eigen_vector.Transpose();
-        double eigen_value = static_cast<double>(eigen_vector_T * (A * eigen_vector) / (eigen_vector_T * eigen_vector));
+        kernel::Gemm(1.0, A, eigen_vector, 0.0, product);
+        double eigen_value = kernel::Dot(eigen_vector, product) / kernel::Dot(eigen_vector, eigen_vector);
 
         result_values(i, 0) = eigen_value;
-        result_vectors.SetRow(i, eigen_vector);
+        kernel::Copy(eigen_vector, result_vectors.ColView(i));
 
-        A -= eigen_vector * eigen_value * eigen_vector_T;
+        // Deflation, A -= eigen_value * v * v^T as a rank-1 update in place.
+        const ConstMatrixView v = eigen_vector.View();
+        kernel::Gemm(-eigen_value, v, v.Transpose(), 1.0, A);
     }
 
     return std::make_pair(result_values, result_vectors);
 }
+
+bool EigenSolver::IsSymmetric(const Matrix& mat) {
+    const double tolerance = kSymmetryTolerance * Matrix::Norm2(mat);
+    for (std::size_t r = 0; r < mat.Row(); ++r) {
+        for (std::size_t c = 0; c < r; ++c) {
+            if (std::abs(mat.AtUnchecked(r, c) - mat.AtUnchecked(c, r)) > tolerance) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::pair<Matrix, Matrix> EigenSolver::SolveSymmetric(const Matrix& mat) {
+    SymmetricEigenSolver solver(mat);
+    Matrix values = solver.Eigenvalues();
+    Matrix vectors = solver.Eigenvectors();
+
+    const std::size_t size = mat.Row();
+    memory::Vector<std::size_t> order(size);
+    std::iota(std::begin(order), std::end(order), 0);
+    // Ties broken by index, the order of a stable sort without its temporary buffer.
+    std::sort(std::begin(order), std::end(order), [&values](std::size_t lhs, std::size_t rhs) {
+        const double lhs_abs = std::abs(values(lhs, 0));
+        const double rhs_abs = std::abs(values(rhs, 0));
+        return (lhs_abs > rhs_abs) || ((lhs_abs == rhs_abs) && (lhs < rhs));
+    });
+
+    Matrix result_values(size, 1);
+    Matrix result_vectors(size, size);
+    for (std::size_t i = 0; i < size; ++i) {
+        result_values(i, 0) = values(order[i], 0);
+        kernel::Copy(vectors.ColView(order[i]), result_vectors.ColView(i));
+    }
+    return std::make_pair(result_values, result_vectors);
+}
 }  // namespace matrix
 }  // namespace math_cpp
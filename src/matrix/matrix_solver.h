@@ -14,19 +14,29 @@
 #include <utility>
 
 #include "src/matrix/matrix_core.h"
+#include "src/memory/workspace.h"
 
 namespace math_cpp {
 namespace matrix {
 
+/// @brief Eigen pairs ordered by descending absolute eigen value. Symmetric matrices go through SymmetricEigenSolver,
+/// other matrices through power iteration with deflation, which is only meaningful for real spectra.
 class EigenSolver {
  public:
+    EigenSolver() = default;
     explicit EigenSolver(const Matrix& mat);
 
+    /// @brief Solves mat with the temporaries in workspace. The results reuse the buffers of the previous call when
+    /// the size is the same, so solving many same-sized matrices allocates nothing after warm-up.
+    void Compute(const Matrix& mat, memory::Workspace& workspace);
+
     Matrix Eigenvalues() const;
     Matrix Eigenvectors() const;
 
  private:
     std::pair<Matrix, Matrix> Solve(const Matrix& mat);
+    static bool IsSymmetric(const Matrix& mat);
+    static std::pair<Matrix, Matrix> SolveSymmetric(const Matrix& mat);
     Matrix eigenvalues_{};
     Matrix eigenvectors_{};
 };
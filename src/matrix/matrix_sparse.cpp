@@ -0,0 +1,219 @@
+/// @file matrix_sparse.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_sparse.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "src/matrix/matrix_kernel.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+
+SparseMatrix::Builder::Builder(std::size_t row, std::size_t col) : row_(row), col_(col) {}
+
+SparseMatrix::Builder& SparseMatrix::Builder::Add(std::size_t row, std::size_t col, double value) {
+    if ((row >= row_) || (col >= col_)) {
+        throw std::invalid_argument("check row and col, element is outside the matrix");
+    }
+    triplets_.push_back(Triplet{row, col, value});
+    return *this;
+}
+
+void SparseMatrix::Builder::Reserve(std::size_t count) { triplets_.reserve(count); }
+
+SparseMatrix SparseMatrix::Builder::Build(Format format) const {
+    SparseMatrix result(format, row_, col_);
+    const bool csr = (format == Format::kCSR);
+    auto outer = [csr](const Triplet& t) { return csr ? t.row : t.col; };
+    auto inner = [csr](const Triplet& t) { return csr ? t.col : t.row; };
+
+    std::vector<Triplet> sorted = triplets_;
+    std::sort(std::begin(sorted), std::end(sorted), [&](const Triplet& lhs, const Triplet& rhs) {
+        return (outer(lhs) != outer(rhs)) ? (outer(lhs) < outer(rhs)) : (inner(lhs) < inner(rhs));
+    });
+
+    result.indices_.reserve(sorted.size());
+    result.values_.reserve(sorted.size());
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        const Triplet& t = sorted[i];
+        const bool duplicate = (i > 0) && (outer(sorted[i - 1]) == outer(t)) && (inner(sorted[i - 1]) == inner(t));
+        if (duplicate) {
+            result.values_.back() += t.value;
+        } else {
+            result.indices_.push_back(inner(t));
+            result.values_.push_back(t.value);
+            ++result.offsets_[outer(t) + 1];
+        }
+    }
+    std::partial_sum(std::begin(result.offsets_), std::end(result.offsets_), std::begin(result.offsets_));
+    return result;
+}
+
+SparseMatrix::SparseMatrix(Format format, std::size_t row, std::size_t col)
+    : format_(format), row_(row), col_(col), offsets_(OuterSize() + 1, 0) {}
+
+SparseMatrix::SparseMatrix(const Matrix& dense, Format format) : SparseMatrix(format, dense.Row(), dense.Col()) {
+    const bool csr = (format == Format::kCSR);
+    for (std::size_t i = 0; i < OuterSize(); ++i) {
+        const std::size_t inner_size = csr ? col_ : row_;
+        for (std::size_t j = 0; j < inner_size; ++j) {
+            const double value = csr ? dense.AtUnchecked(i, j) : dense.AtUnchecked(j, i);
+            if (value != 0.0) {
+                indices_.push_back(j);
+                values_.push_back(value);
+            }
+        }
+        offsets_[i + 1] = indices_.size();
+    }
+}
+
+std::size_t SparseMatrix::Row() const { return row_; }
+std::size_t SparseMatrix::Col() const { return col_; }
+std::size_t SparseMatrix::NonZeros() const { return values_.size(); }
+SparseMatrix::Format SparseMatrix::GetFormat() const { return format_; }
+
+const memory::Vector<std::size_t>& SparseMatrix::Offsets() const { return offsets_; }
+const memory::Vector<std::size_t>& SparseMatrix::Indices() const { return indices_; }
+const memory::Vector<double>& SparseMatrix::Values() const { return values_; }
+
+std::size_t SparseMatrix::OuterSize() const { return (format_ == Format::kCSR) ? row_ : col_; }
+
+double SparseMatrix::At(std::size_t row, std::size_t col) const {
+    if ((row >= row_) || (col >= col_)) {
+        throw std::invalid_argument("check row and col, element is outside the matrix");
+    }
+    const bool csr = (format_ == Format::kCSR);
+    const std::size_t outer = csr ? row : col;
+    const std::size_t inner = csr ? col : row;
+    const auto first = std::begin(indices_) + static_cast<std::ptrdiff_t>(offsets_[outer]);
+    const auto last = std::begin(indices_) + static_cast<std::ptrdiff_t>(offsets_[outer + 1]);
+    const auto found = std::lower_bound(first, last, inner);
+    return ((found != last) && (*found == inner)) ? values_[static_cast<std::size_t>(found - std::begin(indices_))]
+                                                  : 0.0;
+}
+
+Matrix SparseMatrix::ToDense() const {
+    Matrix result(row_, col_);
+    const bool csr = (format_ == Format::kCSR);
+    for (std::size_t i = 0; i < OuterSize(); ++i) {
+        for (std::size_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+            if (csr) {
+                result.AtUnchecked(i, indices_[k]) = values_[k];
+            } else {
+                result.AtUnchecked(indices_[k], i) = values_[k];
+            }
+        }
+    }
+    return result;
+}
+
+/// Counting sort by inner index. Walking the outer indices in order keeps every new segment sorted.
+SparseMatrix SparseMatrix::ToFormat(Format format) const {
+    if (format == format_) {
+        return *this;
+    }
+    SparseMatrix result(format, row_, col_);
+    const std::size_t new_outer = result.OuterSize();
+    for (std::size_t k = 0; k < indices_.size(); ++k) {
+        ++result.offsets_[indices_[k] + 1];
+    }
+    std::partial_sum(std::begin(result.offsets_), std::end(result.offsets_), std::begin(result.offsets_));
+
+    result.indices_.resize(indices_.size());
+    result.values_.resize(values_.size());
+    memory::Vector<std::size_t> next(std::begin(result.offsets_), std::begin(result.offsets_) + new_outer);
+    for (std::size_t i = 0; i < OuterSize(); ++i) {
+        for (std::size_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+            const std::size_t position = next[indices_[k]]++;
+            result.indices_[position] = i;
+            result.values_[position] = values_[k];
+        }
+    }
+    return result;
+}
+
+/// CSR of A has the arrays of CSC of A^T, so the transpose is a relabel followed by a format change.
+SparseMatrix SparseMatrix::Transpose() const {
+    SparseMatrix relabeled = *this;
+    relabeled.format_ = (format_ == Format::kCSR) ? Format::kCSC : Format::kCSR;
+    std::swap(relabeled.row_, relabeled.col_);
+    return relabeled.ToFormat(format_);
+}
+
+void SpMM(double alpha, const SparseMatrix& a, const ConstMatrixView& b, double beta, const MatrixView& c) {
+    if ((a.Col() != b.Row()) || (a.Row() != c.Row()) || (b.Col() != c.Col())) {
+        throw std::invalid_argument("cannot matrix multiply, check size!");
+    }
+    const auto& offsets = a.Offsets();
+    const auto& indices = a.Indices();
+    const auto& values = a.Values();
+    const std::size_t m = c.Col();
+    auto scale_c = [beta](const MatrixView& block) {
+        if (beta == 0.0) {
+            for (std::size_t r = 0; r < block.Row(); ++r) {
+                for (std::size_t j = 0; j < block.Col(); ++j) {
+                    block.AtUnchecked(r, j) = 0.0;
+                }
+            }
+        } else if (beta != 1.0) {
+            kernel::Scale(beta, block);
+        }
+    };
+
+    if (a.GetFormat() == SparseMatrix::Format::kCSR) {
+        const std::size_t work = (a.NonZeros() / std::max<std::size_t>(a.Row(), 1) + 1) * m * 2;
+        parallel::ParallelFor(0, a.Row(), work, [&](std::size_t first, std::size_t last) {
+            scale_c(c.Block(first, 0, last - first, m));
+            for (std::size_t r = first; r < last; ++r) {
+                if (m == 1) {
+                    double sum = 0.0;
+                    for (std::size_t k = offsets[r]; k < offsets[r + 1]; ++k) {
+                        sum += values[k] * b.AtUnchecked(indices[k], 0);
+                    }
+                    c.AtUnchecked(r, 0) += alpha * sum;
+                    continue;
+                }
+                // Every stored element scales a whole row of b into row r of c, both read along their rows.
+                const MatrixView c_row = c.RowView(r);
+                for (std::size_t k = offsets[r]; k < offsets[r + 1]; ++k) {
+                    kernel::Axpy(alpha * values[k], b.RowView(indices[k]), c_row);
+                }
+            }
+        });
+        return;
+    }
+
+    // CSC scatters every column of a into all of c, the right hand sides are the independent unit.
+    parallel::ParallelFor(0, m, a.NonZeros() * 2 + c.Row(), [&](std::size_t first, std::size_t last) {
+        scale_c(c.Block(0, first, c.Row(), last - first));
+        for (std::size_t col = 0; col < a.Col(); ++col) {
+            for (std::size_t k = offsets[col]; k < offsets[col + 1]; ++k) {
+                const double scaled = alpha * values[k];
+                for (std::size_t j = first; j < last; ++j) {
+                    c.AtUnchecked(indices[k], j) += scaled * b.AtUnchecked(col, j);
+                }
+            }
+        }
+    });
+}
+
+Matrix operator*(const SparseMatrix& lhs, const Matrix& rhs) {
+    Matrix result(lhs.Row(), rhs.Col());
+    SpMM(1.0, lhs, rhs, 0.0, result);
+    return result;
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
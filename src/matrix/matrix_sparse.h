@@ -0,0 +1,96 @@
+/// @file matrix_sparse.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Compressed sparse row / column matrices.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_SPARSE_H_
+#define SRC_MATRIX_MATRIX_SPARSE_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "src/matrix/matrix_core.h"
+#include "src/matrix/matrix_view.h"
+#include "src/memory/allocator.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Matrix that stores only its non-zero elements, row by row (CSR) or column by column (CSC).
+/// The elements of outer index i (a row for CSR, a column for CSC) are Values()[Offsets()[i] .. Offsets()[i + 1]) at
+/// inner indices Indices()[...], sorted ascending. Memory is O(non-zeros + outer size).
+class SparseMatrix {
+ public:
+    enum class Format { kCSR, kCSC };
+
+    /// @brief Collects (row, col, value) triplets in any order. Duplicates are summed when the matrix is built.
+    class Builder {
+     public:
+        explicit Builder(std::size_t row, std::size_t col);
+
+        /// @brief Throws when (row, col) is outside the matrix.
+        Builder& Add(std::size_t row, std::size_t col, double value);
+        void Reserve(std::size_t count);
+        SparseMatrix Build(Format format = Format::kCSR) const;
+
+     private:
+        struct Triplet {
+            std::size_t row;
+            std::size_t col;
+            double value;
+        };
+
+        std::size_t row_;
+        std::size_t col_;
+        std::vector<Triplet> triplets_{};
+    };
+
+    SparseMatrix() = default;
+    /// @brief Non-zero elements of a dense matrix.
+    explicit SparseMatrix(const Matrix& dense, Format format = Format::kCSR);
+
+    std::size_t Row() const;
+    std::size_t Col() const;
+    std::size_t NonZeros() const;
+    Format GetFormat() const;
+
+    const memory::Vector<std::size_t>& Offsets() const;
+    const memory::Vector<std::size_t>& Indices() const;
+    const memory::Vector<double>& Values() const;
+
+    /// @brief Element (row, col), 0 when it is not stored. Binary search in the row or column.
+    double At(std::size_t row, std::size_t col) const;
+
+    Matrix ToDense() const;
+    /// @brief The same matrix in the other layout, O(non-zeros).
+    SparseMatrix ToFormat(Format format) const;
+    /// @brief Transposed matrix in the same format, O(non-zeros).
+    SparseMatrix Transpose() const;
+
+ private:
+    SparseMatrix(Format format, std::size_t row, std::size_t col);
+    std::size_t OuterSize() const;
+
+    Format format_{Format::kCSR};
+    std::size_t row_{};
+    std::size_t col_{};
+    memory::Vector<std::size_t> offsets_{};
+    memory::Vector<std::size_t> indices_{};
+    memory::Vector<double> values_{};
+};
+
+/// @brief c = alpha * a * b + beta * c, b and c dense. SpMV is the single column case. CSR splits the rows of c over
+/// the thread pool, CSC the columns of c, so prefer CSR for products with a single vector. When beta is 0, c is not
+/// read.
+void SpMM(double alpha, const SparseMatrix& a, const ConstMatrixView& b, double beta, const MatrixView& c);
+
+Matrix operator*(const SparseMatrix& lhs, const Matrix& rhs);
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_SPARSE_H_
@@ -0,0 +1,82 @@
+/// @file matrix_storage.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_storage.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace math_cpp {
+namespace matrix {
+
+constexpr std::size_t Storage::kInlineCapacity;
+
+Storage::Storage(std::size_t size, double value) {
+    Reserve(size);
+    std::fill(data_, data_ + size_, value);
+}
+
+Storage::Storage(const Storage& other) {
+    Reserve(other.size_);
+    std::copy(other.data_, other.data_ + size_, data_);
+}
+
+Storage::Storage(Storage&& other) noexcept { *this = std::move(other); }
+
+Storage& Storage::operator=(const Storage& other) {
+    if (this != &other) {
+        // Same-sized assignments, the common case in loops, keep the current buffer.
+        if (size_ != other.size_) {
+            Reserve(other.size_);
+        }
+        std::copy(other.data_, other.data_ + size_, data_);
+    }
+    return *this;
+}
+
+Storage& Storage::operator=(Storage&& other) noexcept {
+    if (this != &other) {
+        Release();
+        if (other.IsInline()) {
+            std::copy(other.data_, other.data_ + other.size_, inline_);
+        } else {
+            data_ = other.data_;
+            allocator_ = other.allocator_;
+        }
+        size_ = other.size_;
+        other.data_ = other.inline_;
+        other.size_ = 0;
+        other.allocator_ = nullptr;
+    }
+    return *this;
+}
+
+Storage::~Storage() { Release(); }
+
+void Storage::Reserve(std::size_t size) {
+    Release();
+    if (size > kInlineCapacity) {
+        allocator_ = &memory::AllocatorScope::Current();
+        data_ = static_cast<double*>(allocator_->Allocate(size * sizeof(double), memory::kDefaultAlignment));
+    }
+    size_ = size;
+}
+
+void Storage::Release() {
+    if (!IsInline()) {
+        allocator_->Deallocate(data_, size_ * sizeof(double), memory::kDefaultAlignment);
+    }
+    data_ = inline_;
+    size_ = 0;
+    allocator_ = nullptr;
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,62 @@
+/// @file matrix_storage.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Element buffer of Matrix.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_STORAGE_H_
+#define SRC_MATRIX_MATRIX_STORAGE_H_
+
+#include <cstddef>
+
+#include "src/memory/allocator.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Contiguous doubles with a small buffer. Up to kInlineCapacity elements live inside the object, larger
+/// buffers come 64-byte aligned from the allocator of the current memory::AllocatorScope. A buffer is returned to
+/// the allocator it came from, copies allocate from the current one.
+class Storage {
+ public:
+    static constexpr std::size_t kInlineCapacity = 16;
+
+    Storage() = default;
+    Storage(std::size_t size, double value);
+    Storage(const Storage& other);
+    Storage(Storage&& other) noexcept;
+    Storage& operator=(const Storage& other);
+    Storage& operator=(Storage&& other) noexcept;
+    ~Storage();
+
+    double* Data() { return data_; }
+    const double* Data() const { return data_; }
+    std::size_t Size() const { return size_; }
+    bool IsInline() const { return data_ == inline_; }
+
+    double& operator[](std::size_t index) { return data_[index]; }
+    double operator[](std::size_t index) const { return data_[index]; }
+
+    double* begin() { return data_; }
+    double* end() { return data_ + size_; }
+    const double* begin() const { return data_; }
+    const double* end() const { return data_ + size_; }
+
+ private:
+    /// Points data_ to a buffer for size elements, the previous content is lost.
+    void Reserve(std::size_t size);
+    void Release();
+
+    double* data_{inline_};
+    std::size_t size_{};
+    memory::Allocator* allocator_{nullptr};
+    double inline_[kInlineCapacity];
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_STORAGE_H_
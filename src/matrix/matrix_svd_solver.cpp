@@ -0,0 +1,482 @@
+/// @file matrix_svd_solver.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_svd_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "src/matrix/matrix_kernel.h"
+#include "src/matrix/matrix_qr_solver.h"
+#include "src/matrix/matrix_simd.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+
+namespace {
+// Columns reduced per panel of the bidiagonalization, also the reflectors per compact WY block of the vectors.
+constexpr std::size_t kBlock = 32;
+// QR sweeps allowed per singular value. Two or three are usual, this only guards against NaN input.
+constexpr std::size_t kMaxSweeps = 75;
+
+/// y = a * x for a rows x cols block with rows ld apart.
+void Multiply(const double* a, std::size_t ld, std::size_t rows, std::size_t cols, const double* x, double* y) {
+    parallel::ParallelFor(0, rows, cols, [=](std::size_t first, std::size_t last) {
+        for (std::size_t r = first; r < last; ++r) {
+            y[r] = simd::Dot(a + r * ld, x, cols);
+        }
+    });
+}
+
+/// (upper, lower) = (c * upper + s * lower, c * lower - s * upper)
+void RotateRows(double* upper, double* lower, std::size_t size, double c, double s) {
+    for (std::size_t k = 0; k < size; ++k) {
+        const double y = upper[k];
+        const double z = lower[k];
+        upper[k] = y * c + z * s;
+        lower[k] = z * c - y * s;
+    }
+}
+
+/// Rotations first .. last of a sweep, rotation j mixing rows j and j + 1. Split by columns over the thread pool, a
+/// column block stays in cache through the whole sweep.
+void RotateSweep(Matrix& rows, const double* cosines, const double* sines, std::size_t first, std::size_t last) {
+    const std::size_t size = rows.Col();
+    double* data = rows.Data();
+    parallel::ParallelFor(0, size, 6 * (last - first + 1), [=](std::size_t begin, std::size_t end) {
+        for (std::size_t j = first; j <= last; ++j) {
+            double* upper = data + j * size;
+            RotateRows(upper + begin, upper + size + begin, end - begin, cosines[j], sines[j]);
+        }
+    });
+}
+}  // namespace
+
+SVDSolver::SVDSolver(const Matrix& mat, Mode mode) : mode_(mode), row_(mat.Row()), col_(mat.Col()) {
+    if (std::min(row_, col_) == 0) {
+        return;
+    }
+    // A wide matrix is decomposed as A^T = V * S * U^T.
+    const bool transposed = row_ < col_;
+    Matrix work = transposed ? mat.Transpose() : mat;
+    const std::size_t m = work.Row();
+    const std::size_t n = work.Col();
+
+    // Past about 5 / 3 rows per column the QR step costs less than it saves (the LAPACK xGESVD crossover).
+    if (3 * m > 5 * n) {
+        // A = Q * R and R = U_R * S * V^T, so U = Q * U_R.
+        QRSolver qr(work);
+        Matrix r = qr.R();
+        Decompose(r);
+        if (mode_ == Mode::kValuesAndVectors) {
+            Matrix u(m, n);
+            kernel::Copy(u_transpose_.View().Transpose(), u.Block(0, 0, n, n));
+            qr.ApplyQ(u.View());
+            u_transpose_ = u.Transpose();
+        }
+    } else {
+        Decompose(work);
+    }
+
+    if (transposed) {
+        std::swap(u_transpose_, v_transpose_);
+    }
+}
+
+Matrix SVDSolver::SingularValues() const {
+    Matrix result(diagonal_.size(), 1);
+    std::copy(std::begin(diagonal_), std::end(diagonal_), result.Data());
+    return result;
+}
+
+Matrix SVDSolver::U() const {
+    if (mode_ == Mode::kValuesOnly) {
+        throw std::invalid_argument("singular vectors were not computed, use Mode::kValuesAndVectors");
+    }
+    return u_transpose_.Transpose();
+}
+
+Matrix SVDSolver::VTranspose() const {
+    if (mode_ == Mode::kValuesOnly) {
+        throw std::invalid_argument("singular vectors were not computed, use Mode::kValuesAndVectors");
+    }
+    return v_transpose_;
+}
+
+Matrix SVDSolver::PseudoInverse(double tolerance) const {
+    if (mode_ == Mode::kValuesOnly) {
+        throw std::invalid_argument("singular vectors were not computed, use Mode::kValuesAndVectors");
+    }
+    Matrix result(col_, row_);
+    const std::size_t rank = Rank(tolerance);
+    if (rank == 0) {
+        return result;
+    }
+    // A^+ = sum over i < rank of v_i * u_i^T / S(i)
+    Matrix scaled(rank, row_);
+    for (std::size_t i = 0; i < rank; ++i) {
+        simd::Scale(1.0 / diagonal_[i], u_transpose_.Data() + i * row_, scaled.Data() + i * row_, row_);
+    }
+    kernel::Gemm(1.0, v_transpose_.Block(0, 0, rank, col_).Transpose(), scaled, 0.0, result);
+    return result;
+}
+
+std::size_t SVDSolver::Rank(double tolerance) const {
+    const double threshold = DefaultTolerance(tolerance);
+    return static_cast<std::size_t>(std::count_if(std::begin(diagonal_), std::end(diagonal_),
+                                                  [threshold](double value) { return value > threshold; }));
+}
+
+double SVDSolver::ConditionNumber() const {
+    if (diagonal_.empty()) {
+        return 0.0;
+    }
+    const double smallest = diagonal_[diagonal_.size() - 1];
+    if (smallest == 0.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return diagonal_[0] / smallest;
+}
+
+double SVDSolver::DefaultTolerance(double tolerance) const {
+    if (tolerance >= 0.0) {
+        return tolerance;
+    }
+    const double largest = diagonal_.empty() ? 0.0 : diagonal_[0];
+    return static_cast<double>(std::max(row_, col_)) * std::numeric_limits<double>::epsilon() * largest;
+}
+
+void SVDSolver::Decompose(Matrix& a) {
+    Bidiagonalize(a);
+    if (mode_ == Mode::kValuesAndVectors) {
+        FormVectors(a);
+    }
+    DiagonalizeBidiagonal();
+    Sort();
+}
+
+/// Panel of the blocked reduction (LAPACK xLABRD). The reflectors of the panel are not applied to the rest of the
+/// matrix one by one: X and Y collect them so that after the panel A22 -= V * Y^T + X * W^T, two GEMMs, where V and W
+/// are the left and right reflectors. Every column and row of the panel is brought up to date from X and Y right
+/// before its own reflector is computed. X and Y are stored transposed so that their columns are contiguous.
+void SVDSolver::Bidiagonalize(Matrix& a) {
+    const std::size_t p = a.Row();
+    const std::size_t n = a.Col();
+    const std::size_t ld = n;
+    diagonal_ = memory::Vector<double>(n);
+    super_diagonal_ = memory::Vector<double>(n);
+    tau_left_ = memory::Vector<double>(n);
+    tau_right_ = memory::Vector<double>(n);
+    memory::Vector<double> u(p);
+    memory::Vector<double> t(kBlock + 1);
+    memory::Vector<double> scratch(p);
+
+    for (std::size_t s = 0; s < n; s += kBlock) {
+        const std::size_t nb = std::min(kBlock, n - s);
+        const std::size_t mm = p - s;
+        const std::size_t nn = n - s;
+        double* base = a.Data() + s * ld + s;
+        auto at = [base, ld](std::size_t r, std::size_t c) -> double& { return base[r * ld + c]; };
+        Matrix xt(nb, mm);
+        Matrix yt(nb, nn);
+        auto x_col = [&xt, mm](std::size_t l) { return xt.Data() + l * mm; };
+        auto y_col = [&yt, nn](std::size_t l) { return yt.Data() + l * nn; };
+
+        for (std::size_t i = 0; i < nb; ++i) {
+            const std::size_t rows = mm - i;
+
+            // A(i.., i) -= A(i.., 0..i) * Y(i, 0..i)^T + X(i.., 0..i) * A(0..i, i)
+            for (std::size_t r = 0; r < rows; ++r) {
+                u[r] = at(i + r, i);
+            }
+            if (i > 0) {
+                for (std::size_t l = 0; l < i; ++l) {
+                    t[l] = y_col(l)[i];
+                }
+                Multiply(&at(i, 0), ld, rows, i, t.data(), scratch.data());
+                simd::Axpy(-1.0, scratch.data(), u.data(), rows);
+                for (std::size_t l = 0; l < i; ++l) {
+                    simd::Axpy(-at(l, i), x_col(l) + i, u.data(), rows);
+                }
+            }
+            double tau = 0.0;
+            const MatrixView v(u.data(), rows, 1, 1, 1);
+            diagonal_[s + i] = kernel::MakeReflector(v, tau);
+            tau_left_[s + i] = tau;
+            for (std::size_t r = 0; r < rows; ++r) {
+                at(i + r, i) = u[r];
+            }
+            if (i + 1 == nn) {
+                continue;
+            }
+
+            // Y(i + 1.., i) = tau * (A(i.., i + 1..) - V * Y^T - X * W^T)^T * v
+            const std::size_t cols = nn - i - 1;
+            double* y = y_col(i) + i + 1;
+            kernel::MultiplyTransposed(a.Block(s + i, s + i + 1, rows, cols), v, MatrixView(y, cols, 1, 1, 1));
+            if (i > 0) {
+                kernel::MultiplyTransposed(a.Block(s + i, s, rows, i), v, MatrixView(t.data(), i, 1, 1, 1));
+                for (std::size_t l = 0; l < i; ++l) {
+                    simd::Axpy(-t[l], y_col(l) + i + 1, y, cols);
+                }
+                for (std::size_t l = 0; l < i; ++l) {
+                    t[l] = simd::Dot(x_col(l) + i, u.data(), rows);
+                }
+                for (std::size_t l = 0; l < i; ++l) {
+                    simd::Axpy(-t[l], &at(l, i + 1), y, cols);
+                }
+            }
+            simd::Scale(tau, y, y, cols);
+
+            // A(i, i + 1..) -= A(i, 0..i + 1) * Y(i + 1.., 0..i + 1)^T + X(i, 0..i) * A(0..i, i + 1..)
+            double* row = &at(i, i + 1);
+            for (std::size_t l = 0; l <= i; ++l) {
+                simd::Axpy(-at(i, l), y_col(l) + i + 1, row, cols);
+            }
+            for (std::size_t l = 0; l < i; ++l) {
+                simd::Axpy(-x_col(l)[i], &at(l, i + 1), row, cols);
+            }
+            double tau_row = 0.0;
+            super_diagonal_[s + i] = kernel::MakeReflector(MatrixView(row, 1, cols, cols, 1), tau_row);
+            tau_right_[s + i] = tau_row;
+
+            // X(i + 1.., i) = tau * (A(i + 1.., i + 1..) - V * Y^T - X * W^T) * w
+            const std::size_t below = rows - 1;
+            double* x = x_col(i) + i + 1;
+            Multiply(&at(i + 1, i + 1), ld, below, cols, row, x);
+            for (std::size_t l = 0; l <= i; ++l) {
+                t[l] = simd::Dot(y_col(l) + i + 1, row, cols);
+            }
+            Multiply(&at(i + 1, 0), ld, below, i + 1, t.data(), scratch.data());
+            simd::Axpy(-1.0, scratch.data(), x, below);
+            for (std::size_t l = 0; l < i; ++l) {
+                t[l] = simd::Dot(&at(l, i + 1), row, cols);
+            }
+            for (std::size_t l = 0; l < i; ++l) {
+                simd::Axpy(-t[l], x_col(l) + i + 1, x, below);
+            }
+            simd::Scale(tau_row, x, x, below);
+        }
+
+        if (nb < nn) {
+            const MatrixView trailing = a.Block(s + nb, s + nb, mm - nb, nn - nb);
+            kernel::Gemm(-1.0, a.Block(s + nb, s, mm - nb, nb), yt.Block(0, nb, nb, nn - nb), 1.0, trailing);
+            kernel::Gemm(-1.0, xt.Block(0, nb, nb, mm - nb).Transpose(), a.Block(s, s + nb, nb, nn - nb), 1.0,
+                         trailing);
+        }
+    }
+}
+
+/// U = H(0) * ... * H(n - 1) * [I; 0] and V = G(0) * ... * G(n - 2), applied to the identity block by block from the
+/// last one. Block b only touches rows and columns from its first reflector on, the rest is still the identity.
+void SVDSolver::FormVectors(const Matrix& a) {
+    const std::size_t p = a.Row();
+    const std::size_t n = a.Col();
+
+    Matrix u(p, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        u.AtUnchecked(i, i) = 1.0;
+    }
+    for (std::size_t start = (n - 1) / kBlock * kBlock;; start -= kBlock) {
+        const std::size_t width = std::min(kBlock, n - start);
+        const std::size_t rows = p - start;
+        Matrix v(rows, width);
+        Matrix t(width, width);
+        for (std::size_t c = 0; c < width; ++c) {
+            v.AtUnchecked(c, c) = 1.0;
+            for (std::size_t r = c + 1; r < rows; ++r) {
+                v.AtUnchecked(r, c) = a.AtUnchecked(start + r, start + c);
+            }
+        }
+        kernel::HouseholderBlockFactor(v, tau_left_.data() + start, t);
+        kernel::ApplyBlockReflector(v, t, false, u.Block(start, start, rows, n - start));
+        if (start == 0) {
+            break;
+        }
+    }
+    u_transpose_ = u.Transpose();
+
+    // G(i) acts on the indices i + 1.., its vector is row i of a right of the diagonal.
+    Matrix v_mat = Matrix::Identity(n);
+    for (std::size_t start = (n > 1) ? (n - 2) / kBlock * kBlock : 0; n > 1; start -= kBlock) {
+        const std::size_t width = std::min(kBlock, n - 1 - start);
+        const std::size_t rows = n - 1 - start;
+        Matrix v(rows, width);
+        Matrix t(width, width);
+        for (std::size_t c = 0; c < width; ++c) {
+            v.AtUnchecked(c, c) = 1.0;
+            for (std::size_t r = c + 1; r < rows; ++r) {
+                v.AtUnchecked(r, c) = a.AtUnchecked(start + c, start + 1 + r);
+            }
+        }
+        kernel::HouseholderBlockFactor(v, tau_right_.data() + start, t);
+        kernel::ApplyBlockReflector(v, t, false, v_mat.Block(start + 1, start + 1, rows, rows));
+        if (start == 0) {
+            break;
+        }
+    }
+    v_transpose_ = v_mat.Transpose();
+}
+
+/// Implicit shift QR on the upper bidiagonal matrix (Golub and Reinsch, the svd of EISPACK). A sweep chases the bulge
+/// of a Wilkinson shifted Givens rotation down the unreduced block l..k, and the rotations of the sweep are recorded
+/// and applied afterwards to the rows of the transposed vectors.
+void SVDSolver::DiagonalizeBidiagonal() {
+    const std::size_t n = diagonal_.size();
+    double* w = diagonal_.data();
+    // rv1[i] = B(i - 1, i), rv1[0] = 0
+    memory::Vector<double> rv1(n);
+    for (std::size_t i = 1; i < n; ++i) {
+        rv1[i] = super_diagonal_[i - 1];
+    }
+    double norm = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        norm = std::max(norm, std::abs(w[i]) + std::abs(rv1[i]));
+    }
+    const double negligible = std::numeric_limits<double>::epsilon() * norm;
+    const bool vectors = mode_ == Mode::kValuesAndVectors;
+    memory::Vector<double> cos_v(n);
+    memory::Vector<double> sin_v(n);
+    memory::Vector<double> cos_u(n);
+    memory::Vector<double> sin_u(n);
+
+    for (std::size_t k = n; k-- > 0;) {
+        for (std::size_t sweep = 0;; ++sweep) {
+            // Finds the unreduced block l..k, or a negligible w[l - 1] to cancel first.
+            bool cancel = true;
+            std::size_t l = k;
+            for (;; --l) {
+                if ((l == 0) || (std::abs(rv1[l]) <= negligible)) {
+                    cancel = false;
+                    break;
+                }
+                if (std::abs(w[l - 1]) <= negligible) {
+                    break;
+                }
+            }
+            if (cancel) {
+                // Rotations from the left chase rv1[l] out of row l - 1.
+                double c = 0.0;
+                double s = 1.0;
+                for (std::size_t i = l; i <= k; ++i) {
+                    const double f = s * rv1[i];
+                    rv1[i] *= c;
+                    if (std::abs(f) <= negligible) {
+                        break;
+                    }
+                    const double g = w[i];
+                    const double h = std::hypot(f, g);
+                    w[i] = h;
+                    c = g / h;
+                    s = -f / h;
+                    if (vectors) {
+                        RotateRows(u_transpose_.Data() + (l - 1) * u_transpose_.Col(),
+                                   u_transpose_.Data() + i * u_transpose_.Col(), u_transpose_.Col(), c, s);
+                    }
+                }
+            }
+
+            const double z = w[k];
+            if (l == k) {
+                if (z < 0.0) {
+                    w[k] = -z;
+                    if (vectors) {
+                        simd::Scale(-1.0, v_transpose_.Data() + k * n, v_transpose_.Data() + k * n, n);
+                    }
+                }
+                break;
+            }
+            if (sweep == kMaxSweeps) {
+                throw std::runtime_error("svd solver did not converge");
+            }
+
+            // Shift from the trailing 2 x 2 block of B^T * B.
+            double x = w[l];
+            double y = w[k - 1];
+            double g = rv1[k - 1];
+            double h = rv1[k];
+            double f = ((y - z) * (y + z) + (g - h) * (g + h)) / (2.0 * h * y);
+            g = std::hypot(f, 1.0);
+            f = ((x - z) * (x + z) + h * ((y / (f + std::copysign(g, f))) - h)) / x;
+
+            double c = 1.0;
+            double s = 1.0;
+            for (std::size_t j = l; j < k; ++j) {
+                g = rv1[j + 1];
+                y = w[j + 1];
+                h = s * g;
+                g = c * g;
+                double r = std::hypot(f, h);
+                rv1[j] = r;
+                c = f / r;
+                s = h / r;
+                f = x * c + g * s;
+                g = g * c - x * s;
+                h = y * s;
+                y *= c;
+                cos_v[j] = c;
+                sin_v[j] = s;
+
+                r = std::hypot(f, h);
+                w[j] = r;
+                if (r != 0.0) {
+                    c = f / r;
+                    s = h / r;
+                }
+                f = c * g + s * y;
+                x = c * y - s * g;
+                cos_u[j] = c;
+                sin_u[j] = s;
+            }
+            rv1[l] = 0.0;
+            rv1[k] = f;
+            w[k] = x;
+
+            if (vectors) {
+                RotateSweep(v_transpose_, cos_v.data(), sin_v.data(), l, k - 1);
+                RotateSweep(u_transpose_, cos_u.data(), sin_u.data(), l, k - 1);
+            }
+        }
+    }
+}
+
+void SVDSolver::Sort() {
+    const std::size_t n = diagonal_.size();
+    memory::Vector<std::size_t> order(n);
+    std::iota(std::begin(order), std::end(order), 0);
+    std::stable_sort(std::begin(order), std::end(order),
+                     [this](std::size_t lhs, std::size_t rhs) { return diagonal_[lhs] > diagonal_[rhs]; });
+
+    memory::Vector<double> values(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        values[i] = diagonal_[order[i]];
+    }
+    diagonal_ = std::move(values);
+
+    if (mode_ == Mode::kValuesAndVectors) {
+        for (Matrix* vectors : {&u_transpose_, &v_transpose_}) {
+            const std::size_t size = vectors->Col();
+            Matrix sorted(n, size);
+            for (std::size_t i = 0; i < n; ++i) {
+                const double* src = vectors->Data() + order[i] * size;
+                std::copy(src, src + size, sorted.Data() + i * size);
+            }
+            *vectors = std::move(sorted);
+        }
+    }
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,77 @@
+/// @file matrix_svd_solver.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Singular value decomposition of dense matrices.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_SVD_SOLVER_H_
+#define SRC_MATRIX_MATRIX_SVD_SOLVER_H_
+
+#include <cstddef>
+
+#include "src/matrix/matrix_core.h"
+#include "src/memory/allocator.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief A = U * diag(S) * V^T for an m x n matrix, with k = min(m, n) singular values.
+/// Golub-Kahan bidiagonalization by Householder reflections, blocked by panels of 32 so that half of the work is two
+/// GEMMs per panel (LAPACK xGEBRD), then the implicit shift QR iteration of Golub and Reinsch on the bidiagonal
+/// matrix. Matrices with many more rows than columns are reduced by QRSolver first, wide matrices are decomposed
+/// transposed. The singular vectors are formed with the compact WY kernels of QRSolver.
+class SVDSolver {
+ public:
+    enum class Mode {
+        kValuesAndVectors,
+        /// Skips forming and rotating the singular vectors, several times faster when only the spectrum is needed.
+        kValuesOnly,
+    };
+
+    explicit SVDSolver(const Matrix& mat, Mode mode = Mode::kValuesAndVectors);
+
+    /// @brief k x 1 in descending order, all non-negative.
+    Matrix SingularValues() const;
+    /// @brief m x k with orthonormal columns. Throws in kValuesOnly mode.
+    Matrix U() const;
+    /// @brief k x n with orthonormal rows. Throws in kValuesOnly mode.
+    Matrix VTranspose() const;
+
+    /// @brief n x m Moore-Penrose inverse V * diag(1 / S) * U^T, singular values at or below tolerance count as 0.
+    /// A negative tolerance selects max(m, n) * epsilon * S(0). Throws in kValuesOnly mode.
+    Matrix PseudoInverse(double tolerance = -1.0) const;
+    /// @brief Singular values above tolerance, with the default tolerance of PseudoInverse.
+    std::size_t Rank(double tolerance = -1.0) const;
+    /// @brief S(0) / S(k - 1) in the 2-norm, infinity for a singular matrix.
+    double ConditionNumber() const;
+
+ private:
+    /// Decomposes a square or tall matrix, fills the singular values and, with vectors, u_transpose_ and v_transpose_.
+    void Decompose(Matrix& a);
+    void Bidiagonalize(Matrix& a);
+    void FormVectors(const Matrix& a);
+    void DiagonalizeBidiagonal();
+    void Sort();
+    double DefaultTolerance(double tolerance) const;
+
+    Mode mode_;
+    std::size_t row_;
+    std::size_t col_;
+    memory::Vector<double> diagonal_{};
+    /// super_diagonal_[i] = B(i, i + 1)
+    memory::Vector<double> super_diagonal_{};
+    memory::Vector<double> tau_left_{};
+    memory::Vector<double> tau_right_{};
+    /// The vectors are kept transposed, row i of u_transpose_ is column i of U, so the Givens rotations of the QR
+    /// iteration touch contiguous rows.
+    Matrix u_transpose_{};
+    Matrix v_transpose_{};
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_SVD_SOLVER_H_
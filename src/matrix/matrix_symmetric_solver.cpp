@@ -0,0 +1,294 @@
+/// @file matrix_symmetric_solver.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_symmetric_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "src/matrix/matrix_simd.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace matrix {
+
+namespace {
+// QL sweeps allowed per eigenvalue. Two or three are usual, this only guards against NaN input.
+constexpr std::size_t kMaxSweeps = 64;
+}  // namespace
+
+SymmetricEigenSolver::SymmetricEigenSolver(const Matrix& mat, Mode mode)
+    : mode_(mode), size_(mat.Row()), diagonal_(mat.Row()), off_diagonal_(mat.Row()) {
+    if (mat.Row() != mat.Col()) {
+        throw std::invalid_argument("Eigen should be square matrix");
+    }
+    if (size_ == 0) {
+        return;
+    }
+
+    // vectors_ holds V^T, V starts as the input matrix.
+    vectors_ = mat.Transpose();
+    Tridiagonalize();
+    DiagonalizeTridiagonal();
+    Sort();
+}
+
+Matrix SymmetricEigenSolver::Eigenvalues() const {
+    Matrix result(size_, 1);
+    std::copy(std::begin(diagonal_), std::end(diagonal_), result.Data());
+    return result;
+}
+
+Matrix SymmetricEigenSolver::Eigenvectors() const {
+    if (mode_ == Mode::kValuesOnly) {
+        throw std::invalid_argument("eigenvectors were not computed, use Mode::kValuesAndVectors");
+    }
+    return vectors_.Transpose();
+}
+
+/// Householder reduction to tridiagonal form (tred2 of EISPACK). Every access V(k, j) of the textbook version reads
+/// w[j * n + k] here, which turns the inner loops into dot products and axpys on rows.
+void SymmetricEigenSolver::Tridiagonalize() {
+    const std::size_t n = size_;
+    double* w = vectors_.Data();
+    double* d = diagonal_.data();
+    double* e = off_diagonal_.data();
+    auto at = [w, n](std::size_t row, std::size_t col) -> double& { return w[col * n + row]; };
+
+    for (std::size_t j = 0; j < n; ++j) {
+        d[j] = at(n - 1, j);
+    }
+
+    for (std::size_t i = n - 1; i > 0; --i) {
+        double scale = 0.0;
+        double h = 0.0;
+        for (std::size_t k = 0; k < i; ++k) {
+            scale += std::abs(d[k]);
+        }
+
+        if (scale == 0.0) {
+            e[i] = d[i - 1];
+            for (std::size_t j = 0; j < i; ++j) {
+                d[j] = at(i - 1, j);
+                at(i, j) = 0.0;
+                at(j, i) = 0.0;
+            }
+        } else {
+            // Householder vector in d[0, i)
+            for (std::size_t k = 0; k < i; ++k) {
+                d[k] /= scale;
+                h += d[k] * d[k];
+            }
+            double f = d[i - 1];
+            double g = std::sqrt(h);
+            if (f > 0) {
+                g = -g;
+            }
+            e[i] = scale * g;
+            h -= f * g;
+            d[i - 1] = f - g;
+            std::fill(e, e + i, 0.0);
+
+            // e = A * d on the leading i x i block, reading its lower triangle
+            for (std::size_t j = 0; j < i; ++j) {
+                f = d[j];
+                at(j, i) = f;
+                const double* column = w + j * n;
+                const std::size_t tail = i - j - 1;
+                e[j] += column[j] * f + simd::Dot(column + j + 1, d + j + 1, tail);
+                simd::Axpy(f, column + j + 1, e + j + 1, tail);
+            }
+
+            f = 0.0;
+            for (std::size_t j = 0; j < i; ++j) {
+                e[j] /= h;
+                f += e[j] * d[j];
+            }
+            const double hh = f / (h + h);
+            for (std::size_t j = 0; j < i; ++j) {
+                e[j] -= hh * d[j];
+            }
+
+            // Rank-2 update A -= d * e^T + e * d^T, each column on its own.
+            parallel::ParallelFor(0, i, i, [=](std::size_t first, std::size_t last) {
+                for (std::size_t j = first; j < last; ++j) {
+                    double* column = w + j * n;
+                    simd::Axpy(-d[j], e + j, column + j, i - j);
+                    simd::Axpy(-e[j], d + j, column + j, i - j);
+                }
+            });
+            for (std::size_t j = 0; j < i; ++j) {
+                d[j] = at(i - 1, j);
+                at(i, j) = 0.0;
+            }
+        }
+        d[i] = h;
+    }
+
+    if (mode_ == Mode::kValuesOnly) {
+        for (std::size_t j = 0; j < n; ++j) {
+            d[j] = at(j, j);
+        }
+    } else {
+        // Accumulate the transformations.
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            at(n - 1, i) = at(i, i);
+            at(i, i) = 1.0;
+            const double h = d[i + 1];
+            double* householder = w + (i + 1) * n;
+            if (h != 0.0) {
+                for (std::size_t k = 0; k <= i; ++k) {
+                    d[k] = householder[k] / h;
+                }
+                parallel::ParallelFor(0, i + 1, i + 1, [=](std::size_t first, std::size_t last) {
+                    for (std::size_t j = first; j < last; ++j) {
+                        double* column = w + j * n;
+                        const double g = simd::Dot(householder, column, i + 1);
+                        simd::Axpy(-g, d, column, i + 1);
+                    }
+                });
+            }
+            std::fill(householder, householder + i + 1, 0.0);
+        }
+        for (std::size_t j = 0; j < n; ++j) {
+            d[j] = at(n - 1, j);
+            at(n - 1, j) = 0.0;
+        }
+        at(n - 1, n - 1) = 1.0;
+    }
+    e[0] = 0.0;
+}
+
+/// Implicit shift QL on the tridiagonal matrix (tql2 of EISPACK). The Givens rotations of a sweep are recorded and
+/// then applied to the rows of vectors_, split by columns over the thread pool.
+void SymmetricEigenSolver::DiagonalizeTridiagonal() {
+    const std::size_t n = size_;
+    double* d = diagonal_.data();
+    double* e = off_diagonal_.data();
+    memory::Vector<double> cosines(n);
+    memory::Vector<double> sines(n);
+
+    for (std::size_t i = 1; i < n; ++i) {
+        e[i - 1] = e[i];
+    }
+    e[n - 1] = 0.0;
+
+    double f = 0.0;
+    double tst1 = 0.0;
+    const double eps = std::numeric_limits<double>::epsilon();
+    for (std::size_t l = 0; l < n; ++l) {
+        tst1 = std::max(tst1, std::abs(d[l]) + std::abs(e[l]));
+        std::size_t m = l;
+        while ((m < n - 1) && (std::abs(e[m]) > eps * tst1)) {
+            ++m;
+        }
+
+        if (m > l) {
+            std::size_t sweeps = 0;
+            do {
+                if (++sweeps > kMaxSweeps) {
+                    throw std::runtime_error("symmetric eigen solver did not converge");
+                }
+
+                // Wilkinson shift
+                double g = d[l];
+                double p = (d[l + 1] - g) / (2.0 * e[l]);
+                double r = std::hypot(p, 1.0);
+                if (p < 0) {
+                    r = -r;
+                }
+                d[l] = e[l] / (p + r);
+                d[l + 1] = e[l] * (p + r);
+                const double dl1 = d[l + 1];
+                double h = g - d[l];
+                for (std::size_t i = l + 2; i < n; ++i) {
+                    d[i] -= h;
+                }
+                f += h;
+
+                p = d[m];
+                double c = 1.0;
+                double c2 = c;
+                double c3 = c;
+                const double el1 = e[l + 1];
+                double s = 0.0;
+                double s2 = 0.0;
+                for (std::size_t i = m; i-- > l;) {
+                    c3 = c2;
+                    c2 = c;
+                    s2 = s;
+                    g = c * e[i];
+                    h = c * p;
+                    r = std::hypot(p, e[i]);
+                    e[i + 1] = s * r;
+                    s = e[i] / r;
+                    c = p / r;
+                    p = c * d[i] - s * g;
+                    d[i + 1] = h + s * (c * g + s * d[i]);
+                    cosines[i] = c;
+                    sines[i] = s;
+                }
+                p = -s * s2 * c3 * el1 * e[l] / dl1;
+                e[l] = s * p;
+                d[l] = c * p;
+
+                if (mode_ == Mode::kValuesAndVectors) {
+                    double* w = vectors_.Data();
+                    const double* cs = cosines.data();
+                    const double* sn = sines.data();
+                    parallel::ParallelFor(0, n, 2 * (m - l), [=](std::size_t first, std::size_t last) {
+                        for (std::size_t i = m; i-- > l;) {
+                            double* upper = w + i * n;
+                            double* lower = upper + n;
+                            for (std::size_t k = first; k < last; ++k) {
+                                const double t = lower[k];
+                                lower[k] = sn[i] * upper[k] + cs[i] * t;
+                                upper[k] = cs[i] * upper[k] - sn[i] * t;
+                            }
+                        }
+                    });
+                }
+            } while (std::abs(e[l]) > eps * tst1);
+        }
+        d[l] += f;
+        e[l] = 0.0;
+    }
+}
+
+void SymmetricEigenSolver::Sort() {
+    memory::Vector<std::size_t> order(size_);
+    std::iota(std::begin(order), std::end(order), 0);
+    // Ties broken by index, the order of a stable sort without its temporary buffer.
+    std::sort(std::begin(order), std::end(order), [this](std::size_t lhs, std::size_t rhs) {
+        return (diagonal_[lhs] < diagonal_[rhs]) || ((diagonal_[lhs] == diagonal_[rhs]) && (lhs < rhs));
+    });
+
+    memory::Vector<double> values(size_);
+    for (std::size_t i = 0; i < size_; ++i) {
+        values[i] = diagonal_[order[i]];
+    }
+    std::copy(std::begin(values), std::end(values), std::begin(diagonal_));
+
+    if (mode_ == Mode::kValuesAndVectors) {
+        Matrix sorted(size_, size_);
+        for (std::size_t i = 0; i < size_; ++i) {
+            const double* src = vectors_.Data() + order[i] * size_;
+            std::copy(src, src + size_, sorted.Data() + i * size_);
+        }
+        vectors_ = std::move(sorted);
+    }
+}
+
+}  // namespace matrix
+}  // namespace math_cpp
@@ -0,0 +1,56 @@
+/// @file matrix_symmetric_solver.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Eigen decomposition of symmetric matrices.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_SYMMETRIC_SOLVER_H_
+#define SRC_MATRIX_MATRIX_SYMMETRIC_SOLVER_H_
+
+#include <cstddef>
+
+#include "src/matrix/matrix_core.h"
+#include "src/memory/allocator.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief Eigenvalues and eigenvectors of a symmetric matrix in O(n^3).
+/// The matrix is reduced to tridiagonal form by Householder reflections, then the tridiagonal matrix is diagonalized by
+/// the implicit shift QL algorithm. Only the lower triangle of the input is read.
+class SymmetricEigenSolver {
+ public:
+    enum class Mode {
+        kValuesAndVectors,
+        /// Skips accumulating the transformations, roughly 3x faster when only the spectrum is needed.
+        kValuesOnly,
+    };
+
+    explicit SymmetricEigenSolver(const Matrix& mat, Mode mode = Mode::kValuesAndVectors);
+
+    /// @brief n x 1 column of eigenvalues in ascending order.
+    Matrix Eigenvalues() const;
+    /// @brief n x n matrix whose column i is the unit eigenvector of eigenvalue i. Throws in kValuesOnly mode.
+    Matrix Eigenvectors() const;
+
+ private:
+    void Tridiagonalize();
+    void DiagonalizeTridiagonal();
+    void Sort();
+
+    Mode mode_;
+    std::size_t size_{};
+    /// The transformations are kept transposed, row i of vectors_ is eigenvector i, so that both Householder updates
+    /// and Givens rotations touch contiguous rows.
+    Matrix vectors_{};
+    memory::Vector<double> diagonal_{};
+    memory::Vector<double> off_diagonal_{};
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+#endif  // SRC_MATRIX_MATRIX_SYMMETRIC_SOLVER_H_
@@ -24,17 +24,18 @@ double Util::CosineSimilarity(const Matrix& lhs, const Matrix& rhs) {
         throw std::invalid_argument("rhs should row/col vector");
     }
 
-    Matrix lhs_ = lhs;
-    Matrix rhs_ = rhs;
+    // Both operands are read as row vectors through views, nothing is copied.
+    ConstMatrixView lhs_ = lhs.View();
+    ConstMatrixView rhs_ = rhs.View();
     if (lhs.Col() == 1) {
-        lhs_ = lhs.Transpose();
+        lhs_ = lhs_.Transpose();
     }
-    if (rhs.Row() == 1) {
-        rhs_ = rhs.Transpose();
+    if (rhs.Col() == 1) {
+        rhs_ = rhs_.Transpose();
     }
 
-    double result = static_cast<double>(lhs_ * rhs_);
-    result /= Matrix::Norm2(lhs_) * Matrix::Norm2(rhs_);
+    double result = kernel::Dot(lhs_, rhs_);
+    result /= kernel::Norm2(lhs_) * kernel::Norm2(rhs_);
     return result;
 }
 
@@ -0,0 +1,133 @@
+/// @file matrix_view.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Non-owning strided views into Matrix storage.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MATRIX_MATRIX_VIEW_H_
+#define SRC_MATRIX_MATRIX_VIEW_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "src/matrix/matrix_core.h"
+
+namespace math_cpp {
+namespace matrix {
+
+/// @brief A pointer plus shape plus row and column strides. Element (r, c) is data[r * row_stride + c * col_stride].
+/// Rows, columns, blocks and transposes of a matrix are all views of the same storage, no element is copied. A view
+/// does not own its data and must not outlive the Matrix it refers to.
+/// @tparam T double for a mutable view, const double for a read-only view.
+template <typename T>
+class BasicMatrixView {
+ public:
+    BasicMatrixView() = default;
+    BasicMatrixView(T* data, std::size_t row, std::size_t col, std::size_t row_stride, std::size_t col_stride)
+        : data_(data), row_(row), col_(col), row_stride_(row_stride), col_stride_(col_stride) {}
+
+    /// @brief Views a whole matrix. A read-only view also binds to temporaries, which live until the end of the full
+    /// expression, so they can be passed straight to the kernels.
+    template <typename M, typename = typename std::enable_if<std::is_same<M, Matrix>::value &&
+                                                             !std::is_const<T>::value>::type>
+    BasicMatrixView(M& mat)  // NOLINT(google-explicit-constructor)
+        : BasicMatrixView(mat.Data(), mat.Row(), mat.Col(), mat.Col(), 1) {}
+
+    template <typename M, typename = typename std::enable_if<std::is_same<M, Matrix>::value &&
+                                                             std::is_const<T>::value>::type>
+    BasicMatrixView(const M& mat)  // NOLINT(google-explicit-constructor)
+        : BasicMatrixView(mat.Data(), mat.Row(), mat.Col(), mat.Col(), 1) {}
+
+    /// @brief A mutable view converts to a read-only one.
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    BasicMatrixView(const BasicMatrixView<U>& other)  // NOLINT(google-explicit-constructor)
+        : BasicMatrixView(other.Data(), other.Row(), other.Col(), other.RowStride(), other.ColStride()) {}
+
+    T* Data() const { return data_; }
+    std::size_t Row() const { return row_; }
+    std::size_t Col() const { return col_; }
+    std::size_t RowStride() const { return row_stride_; }
+    std::size_t ColStride() const { return col_stride_; }
+
+    /// @brief Element access. Bounds are checked only when built with MATH_CPP_BOUNDS_CHECK, see Matrix::operator().
+    T& operator()(std::size_t row, std::size_t col) const {
+#ifdef MATH_CPP_BOUNDS_CHECK
+        if ((row >= row_) || (col >= col_)) {
+            throw std::invalid_argument("index exceeds the view, check row and col");
+        }
+#endif
+        return AtUnchecked(row, col);
+    }
+
+    /// @brief Element access that is never checked.
+    T& AtUnchecked(std::size_t row, std::size_t col) const { return data_[row * row_stride_ + col * col_stride_]; }
+
+    /// @brief Pointer to the first element of a row.
+    T* RowData(std::size_t row) const { return data_ + row * row_stride_; }
+
+    bool IsSameSize(const BasicMatrixView& other) const { return (row_ == other.row_) && (col_ == other.col_); }
+
+    /// @brief Elements of each row are adjacent in memory.
+    bool IsRowContiguous() const { return (col_stride_ == 1) || (col_ <= 1); }
+
+    BasicMatrixView Block(std::size_t start_row, std::size_t start_col, std::size_t rows, std::size_t cols) const {
+        if ((start_row + rows > row_) || (start_col + cols > col_)) {
+            throw std::invalid_argument("block exceeds the view, check block position and size");
+        }
+        return BasicMatrixView(data_ + start_row * row_stride_ + start_col * col_stride_, rows, cols, row_stride_,
+                               col_stride_);
+    }
+
+    /// @brief 1 x col view of a row.
+    BasicMatrixView RowView(std::size_t idx) const {
+        if (idx >= row_) {
+            throw std::invalid_argument("check row index");
+        }
+        return Block(idx, 0, 1, col_);
+    }
+
+    /// @brief row x 1 view of a column.
+    BasicMatrixView ColView(std::size_t idx) const {
+        if (idx >= col_) {
+            throw std::invalid_argument("check col index");
+        }
+        return Block(0, idx, row_, 1);
+    }
+
+    BasicMatrixView Transpose() const { return BasicMatrixView(data_, col_, row_, col_stride_, row_stride_); }
+
+    /// @brief Copies the viewed elements into a new Matrix.
+    Matrix ToMatrix() const {
+        Matrix result(row_, col_);
+        double* dst = result.Data();
+        for (std::size_t r = 0; r < row_; ++r) {
+            const T* src = RowData(r);
+            if (IsRowContiguous()) {
+                std::copy(src, src + col_, dst + r * col_);
+            } else {
+                for (std::size_t c = 0; c < col_; ++c) {
+                    dst[r * col_ + c] = src[c * col_stride_];
+                }
+            }
+        }
+        return result;
+    }
+
+ private:
+    T* data_{nullptr};
+    std::size_t row_{};
+    std::size_t col_{};
+    std::size_t row_stride_{};
+    std::size_t col_stride_{};
+};
+
+}  // namespace matrix
+}  // namespace math_cpp
+
+#endif  // SRC_MATRIX_MATRIX_VIEW_H_
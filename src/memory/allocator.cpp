@@ -0,0 +1,119 @@
+/// @file allocator.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/memory/allocator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace math_cpp {
+namespace memory {
+
+namespace {
+thread_local Allocator* current_allocator = nullptr;
+
+std::size_t AlignUp(std::size_t value, std::size_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+}  // namespace
+
+HeapAllocator& HeapAllocator::GetInstance() {
+    static HeapAllocator instance{};
+    return instance;
+}
+
+/// operator new only guarantees alignof(std::max_align_t) before C++17. The block is over-allocated, the returned
+/// pointer is aligned up and the original pointer is kept right before it.
+void* HeapAllocator::Allocate(std::size_t bytes, std::size_t alignment) {
+    alignment = std::max(alignment, alignof(void*));
+    void* raw = ::operator new(bytes + alignment + sizeof(void*));
+    const auto address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+    void* aligned = reinterpret_cast<void*>(AlignUp(address, alignment));
+    static_cast<void**>(aligned)[-1] = raw;
+    return aligned;
+}
+
+void HeapAllocator::Deallocate(void* ptr, std::size_t /*bytes*/, std::size_t /*alignment*/) {
+    if (ptr != nullptr) {
+        ::operator delete(static_cast<void**>(ptr)[-1]);
+    }
+}
+
+ArenaAllocator::ArenaAllocator(std::size_t chunk_bytes) : chunk_bytes_(chunk_bytes) {}
+
+ArenaAllocator::~ArenaAllocator() {
+    for (const Chunk& chunk : chunks_) {
+        HeapAllocator::GetInstance().Deallocate(chunk.data, chunk.size, kDefaultAlignment);
+    }
+}
+
+void* ArenaAllocator::Allocate(std::size_t bytes, std::size_t alignment) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto aligned_offset = [this, alignment]() {
+        const auto base = reinterpret_cast<std::uintptr_t>(chunks_.back().data);
+        return static_cast<std::size_t>(AlignUp(base + offset_, alignment) - base);
+    };
+
+    std::size_t start = chunks_.empty() ? 0 : aligned_offset();
+    if (chunks_.empty() || (start + bytes > chunks_.back().size)) {
+        AddChunk(bytes + alignment);
+        offset_ = 0;
+        start = aligned_offset();
+    }
+    offset_ = start + bytes;
+    used_ += bytes;
+    return chunks_.back().data + start;
+}
+
+void ArenaAllocator::Deallocate(void* /*ptr*/, std::size_t /*bytes*/, std::size_t /*alignment*/) {}
+
+void ArenaAllocator::Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t i = 1; i < chunks_.size(); ++i) {
+        HeapAllocator::GetInstance().Deallocate(chunks_[i].data, chunks_[i].size, kDefaultAlignment);
+    }
+    if (!chunks_.empty()) {
+        chunks_.resize(1);
+    }
+    offset_ = 0;
+    used_ = 0;
+}
+
+std::size_t ArenaAllocator::BytesUsed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return used_;
+}
+
+std::size_t ArenaAllocator::Capacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t capacity = 0;
+    for (const Chunk& chunk : chunks_) {
+        capacity += chunk.size;
+    }
+    return capacity;
+}
+
+void ArenaAllocator::AddChunk(std::size_t min_bytes) {
+    const std::size_t size = std::max(chunk_bytes_, min_bytes);
+    auto* data = static_cast<char*>(HeapAllocator::GetInstance().Allocate(size, kDefaultAlignment));
+    chunks_.push_back(Chunk{data, size});
+}
+
+AllocatorScope::AllocatorScope(Allocator& allocator) : previous_(current_allocator) {
+    current_allocator = &allocator;
+}
+
+AllocatorScope::~AllocatorScope() { current_allocator = previous_; }
+
+Allocator& AllocatorScope::Current() {
+    return (current_allocator != nullptr) ? *current_allocator : HeapAllocator::GetInstance();
+}
+
+}  // namespace memory
+}  // namespace math_cpp
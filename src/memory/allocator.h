@@ -0,0 +1,148 @@
+/// @file allocator.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Pluggable allocators for matrix storage.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MEMORY_ALLOCATOR_H_
+#define SRC_MEMORY_ALLOCATOR_H_
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace math_cpp {
+namespace memory {
+
+/// @brief Alignment of every heap buffer of a Matrix, one cache line and wide enough for any SIMD load.
+constexpr std::size_t kDefaultAlignment = 64;
+
+/// @brief Source of raw memory for Matrix storage.
+class Allocator {
+ public:
+    virtual ~Allocator() = default;
+
+    /// @brief Returns bytes of memory aligned to alignment, a power of two. Throws std::bad_alloc on failure.
+    virtual void* Allocate(std::size_t bytes, std::size_t alignment) = 0;
+    /// @brief Returns memory obtained from Allocate with the same bytes and alignment.
+    virtual void Deallocate(void* ptr, std::size_t bytes, std::size_t alignment) = 0;
+};
+
+/// @brief Aligned global operator new / delete. The default allocator, safe to call from several threads.
+class HeapAllocator : public Allocator {
+ public:
+    static HeapAllocator& GetInstance();
+
+    void* Allocate(std::size_t bytes, std::size_t alignment) override;
+    void Deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+};
+
+/// @brief Bump allocator over large chunks, safe to call from several threads. Deallocate does nothing, everything is
+/// released at once by Reset() or by the destructor, so temporaries of a request cost a pointer increment each. Memory
+/// obtained from an arena must not be used after the arena is reset or destroyed.
+class ArenaAllocator : public Allocator {
+ public:
+    explicit ArenaAllocator(std::size_t chunk_bytes = std::size_t{1} << 20);
+    ~ArenaAllocator() override;
+
+    ArenaAllocator(const ArenaAllocator&) = delete;
+    ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+    void* Allocate(std::size_t bytes, std::size_t alignment) override;
+    void Deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+
+    /// @brief Releases every allocation. The first chunk is kept for reuse.
+    void Reset();
+
+    /// @brief Bytes handed out since the last Reset.
+    std::size_t BytesUsed() const;
+    /// @brief Bytes held in chunks.
+    std::size_t Capacity() const;
+
+ private:
+    struct Chunk {
+        char* data;
+        std::size_t size;
+    };
+
+    void AddChunk(std::size_t min_bytes);
+
+    std::size_t chunk_bytes_;
+    std::vector<Chunk> chunks_{};
+    std::size_t offset_{};
+    std::size_t used_{};
+    mutable std::mutex mutex_{};
+};
+
+/// @brief Installs an allocator for the matrices created on this thread until the scope ends. Scopes nest, the
+/// previous allocator is restored on destruction.
+///
+/// @code
+/// memory::ArenaAllocator arena{};
+/// Matrix inverse{};
+/// {
+///     memory::AllocatorScope scope(arena);
+///     inverse = A.Inverse();  // the result and every temporary come from the arena
+/// }
+/// Matrix result = inverse;    // copies outside a scope go to the heap
+/// arena.Reset();
+/// @endcode
+class AllocatorScope {
+ public:
+    explicit AllocatorScope(Allocator& allocator);
+    ~AllocatorScope();
+
+    AllocatorScope(const AllocatorScope&) = delete;
+    AllocatorScope& operator=(const AllocatorScope&) = delete;
+
+    /// @brief Allocator of the innermost scope on this thread, HeapAllocator outside any scope.
+    static Allocator& Current();
+
+ private:
+    Allocator* previous_;
+};
+
+/// @brief Standard allocator adapter over the allocator of the current AllocatorScope, so that index and scratch
+/// vectors of the solvers follow the same allocator as their matrices. The allocator is captured at construction.
+template <typename T>
+class ScopedAllocator {
+ public:
+    using value_type = T;
+
+    ScopedAllocator() : allocator_(&AllocatorScope::Current()) {}
+    template <typename U>
+    ScopedAllocator(const ScopedAllocator<U>& other)  // NOLINT(google-explicit-constructor)
+        : allocator_(other.Get()) {}
+
+    T* allocate(std::size_t n) { return static_cast<T*>(allocator_->Allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T* ptr, std::size_t n) { allocator_->Deallocate(ptr, n * sizeof(T), alignof(T)); }
+
+    /// Copies of a container allocate from the scope they are made in, like copies of a Matrix.
+    ScopedAllocator select_on_container_copy_construction() const { return ScopedAllocator(); }
+
+    Allocator* Get() const { return allocator_; }
+
+ private:
+    Allocator* allocator_;
+};
+
+template <typename T, typename U>
+bool operator==(const ScopedAllocator<T>& lhs, const ScopedAllocator<U>& rhs) {
+    return lhs.Get() == rhs.Get();
+}
+
+template <typename T, typename U>
+bool operator!=(const ScopedAllocator<T>& lhs, const ScopedAllocator<U>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename T>
+using Vector = std::vector<T, ScopedAllocator<T>>;
+
+}  // namespace memory
+}  // namespace math_cpp
+#endif  // SRC_MEMORY_ALLOCATOR_H_
@@ -0,0 +1,112 @@
+/// @file workspace.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/memory/workspace.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace math_cpp {
+namespace memory {
+
+namespace {
+std::uintptr_t AlignUp(std::uintptr_t value, std::size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+}  // namespace
+
+Workspace::Frame::Frame(Workspace& workspace)
+    : workspace_(workspace),
+      offset_(workspace.offset_),
+      overflow_count_(workspace.overflow_.size()),
+      used_(workspace.used_),
+      scope_(workspace) {
+    ++workspace_.depth_;
+}
+
+Workspace::Frame::~Frame() {
+    --workspace_.depth_;
+    workspace_.Release(offset_, overflow_count_, used_);
+}
+
+Workspace::Workspace(std::size_t bytes) {
+    // Overflow blocks are bookkept without allocating inside a frame.
+    overflow_.reserve(16);
+    Reserve(bytes);
+}
+
+Workspace::~Workspace() {
+    for (const Block& block : overflow_) {
+        HeapAllocator::GetInstance().Deallocate(block.data, block.size, kDefaultAlignment);
+    }
+    HeapAllocator::GetInstance().Deallocate(buffer_.data, buffer_.size, kDefaultAlignment);
+}
+
+void* Workspace::Allocate(std::size_t bytes, std::size_t alignment) {
+    const auto base = reinterpret_cast<std::uintptr_t>(buffer_.data);
+    const auto start = static_cast<std::size_t>(AlignUp(base + offset_, alignment) - base);
+
+    void* result = nullptr;
+    if ((buffer_.data != nullptr) && (start + bytes <= buffer_.size)) {
+        used_ += start + bytes - offset_;
+        offset_ = start + bytes;
+        result = buffer_.data + start;
+    } else {
+        // Padding is counted in the block so the regrown buffer has room for it.
+        const std::size_t size = bytes + std::max(alignment, kDefaultAlignment);
+        auto* data = static_cast<char*>(HeapAllocator::GetInstance().Allocate(size, kDefaultAlignment));
+        ++heap_allocations_;
+        overflow_.push_back(Block{data, size});
+        used_ += size;
+        result = data;
+    }
+    high_water_mark_ = std::max(high_water_mark_, used_);
+    return result;
+}
+
+void Workspace::Deallocate(void* /*ptr*/, std::size_t /*bytes*/, std::size_t /*alignment*/) {}
+
+void Workspace::Reserve(std::size_t bytes) {
+    if (depth_ != 0) {
+        throw std::logic_error("workspace cannot be resized inside a frame");
+    }
+    if (bytes <= buffer_.size) {
+        return;
+    }
+    HeapAllocator::GetInstance().Deallocate(buffer_.data, buffer_.size, kDefaultAlignment);
+    buffer_.data = static_cast<char*>(HeapAllocator::GetInstance().Allocate(bytes, kDefaultAlignment));
+    buffer_.size = bytes;
+    ++heap_allocations_;
+}
+
+std::size_t Workspace::HighWaterMark() const { return high_water_mark_; }
+
+std::size_t Workspace::BytesUsed() const { return used_; }
+
+std::size_t Workspace::Capacity() const { return buffer_.size; }
+
+std::size_t Workspace::HeapAllocations() const { return heap_allocations_; }
+
+void Workspace::Release(std::size_t offset, std::size_t overflow_count, std::size_t used) {
+    for (std::size_t i = overflow_count; i < overflow_.size(); ++i) {
+        HeapAllocator::GetInstance().Deallocate(overflow_[i].data, overflow_[i].size, kDefaultAlignment);
+    }
+    overflow_.resize(overflow_count);
+    offset_ = offset;
+    used_ = used;
+
+    if ((depth_ == 0) && (high_water_mark_ > buffer_.size)) {
+        Reserve(high_water_mark_);
+    }
+}
+
+}  // namespace memory
+}  // namespace math_cpp
@@ -0,0 +1,96 @@
+/// @file workspace.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Reusable scratch memory for solver temporaries.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_MEMORY_WORKSPACE_H_
+#define SRC_MEMORY_WORKSPACE_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "src/memory/allocator.h"
+
+namespace math_cpp {
+namespace memory {
+
+/// @brief Stack of scratch memory owned by one thread. Temporaries are bumped from a single buffer and released
+/// together when the Frame that made them ends. What does not fit goes to the heap once, and the buffer is regrown to
+/// the high-water mark when the outermost frame ends, so repeated same-shaped work allocates nothing after warm-up.
+///
+/// @code
+/// memory::Workspace workspace{};
+/// Matrix inverse{};
+/// for (const Matrix& A : problems) {
+///     A.Inverse(workspace, inverse);  // no allocation from the second same-sized A on
+///     double det = Matrix::Determinant(A, workspace);
+/// }
+/// @endcode
+class Workspace : public Allocator {
+ public:
+    /// @brief Installs the workspace as the current allocator of this thread and releases every allocation made
+    /// inside when it ends. Frames nest. Matrices created inside a frame must not be used after it ends.
+    class Frame {
+     public:
+        explicit Frame(Workspace& workspace);
+        ~Frame();
+
+        Frame(const Frame&) = delete;
+        Frame& operator=(const Frame&) = delete;
+
+     private:
+        Workspace& workspace_;
+        std::size_t offset_;
+        std::size_t overflow_count_;
+        std::size_t used_;
+        AllocatorScope scope_;
+    };
+
+    explicit Workspace(std::size_t bytes = 0);
+    ~Workspace() override;
+
+    Workspace(const Workspace&) = delete;
+    Workspace& operator=(const Workspace&) = delete;
+
+    void* Allocate(std::size_t bytes, std::size_t alignment) override;
+    /// @brief Does nothing, memory returns to the workspace when its frame ends.
+    void Deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+
+    /// @brief Grows the buffer to at least bytes. Must be called outside any frame.
+    void Reserve(std::size_t bytes);
+
+    /// @brief Largest number of bytes in use at once, padding included. Reserve(HighWaterMark()) sizes a new
+    /// workspace for the same work.
+    std::size_t HighWaterMark() const;
+    /// @brief Bytes in use by the open frames.
+    std::size_t BytesUsed() const;
+    /// @brief Size of the buffer.
+    std::size_t Capacity() const;
+    /// @brief Times the workspace went to the heap, for its buffer or for overflow blocks.
+    std::size_t HeapAllocations() const;
+
+ private:
+    struct Block {
+        char* data;
+        std::size_t size;
+    };
+
+    void Release(std::size_t offset, std::size_t overflow_count, std::size_t used);
+
+    Block buffer_{nullptr, 0};
+    std::size_t offset_{};
+    std::vector<Block> overflow_{};
+    std::size_t used_{};
+    std::size_t high_water_mark_{};
+    std::size_t heap_allocations_{};
+    std::size_t depth_{};
+};
+
+}  // namespace memory
+}  // namespace math_cpp
+#endif  // SRC_MEMORY_WORKSPACE_H_
@@ -0,0 +1,227 @@
+/// @file thread_pool.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/parallel/thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <string>
+
+namespace math_cpp {
+namespace parallel {
+
+namespace {
+constexpr std::size_t kDefaultSerialThreshold = std::size_t{1} << 16;
+
+// Chunks per participating thread. More chunks balance better, fewer chunks cost less to schedule.
+constexpr std::size_t kChunksPerWorker = 4;
+
+thread_local const void* tls_pool = nullptr;
+thread_local std::size_t tls_queue = 0;
+
+std::size_t DefaultWorkerCount() {
+    const char* env = std::getenv("MATH_CPP_NUM_THREADS");
+    if (env != nullptr) {
+        const long value = std::strtol(env, nullptr, 10);
+        if (value > 0) {
+            return static_cast<std::size_t>(value);
+        }
+    }
+    return std::max(1U, std::thread::hardware_concurrency());
+}
+}  // namespace
+
+struct ThreadPool::Job {
+    const RangeFunction* body{nullptr};
+    std::atomic<std::size_t> pending{0};
+    std::mutex mutex{};
+    std::condition_variable done{};
+    std::exception_ptr error{};
+};
+
+void ThreadPool::Queue::PushBack(const Task& task) {
+    if (size == ring.size()) {
+        std::vector<Task> grown(std::max<std::size_t>(16, 2 * ring.size()));
+        for (std::size_t i = 0; i < size; ++i) {
+            grown[i] = ring[(head + i) % ring.size()];
+        }
+        ring.swap(grown);
+        head = 0;
+    }
+    ring[(head + size) % ring.size()] = task;
+    ++size;
+}
+
+ThreadPool::Task ThreadPool::Queue::PopBack() {
+    --size;
+    return ring[(head + size) % ring.size()];
+}
+
+ThreadPool::Task ThreadPool::Queue::PopFront() {
+    const Task task = ring[head];
+    head = (head + 1) % ring.size();
+    --size;
+    return task;
+}
+
+ThreadPool& ThreadPool::GetInstance() {
+    static ThreadPool instance{};
+
+    return instance;
+}
+
+ThreadPool::ThreadPool() : serial_threshold_{kDefaultSerialThreshold} { Start(DefaultWorkerCount()); }
+
+ThreadPool::~ThreadPool() { Stop(); }
+
+std::size_t ThreadPool::WorkerCount() const { return worker_count_; }
+
+void ThreadPool::SetWorkerCount(std::size_t count) {
+    Stop();
+    Start((count == 0) ? DefaultWorkerCount() : count);
+}
+
+std::size_t ThreadPool::SerialThreshold() const { return serial_threshold_.load(std::memory_order_relaxed); }
+
+void ThreadPool::SetSerialThreshold(std::size_t work) { serial_threshold_.store(work, std::memory_order_relaxed); }
+
+void ThreadPool::Start(std::size_t count) {
+    worker_count_ = count;
+    // The calling thread of ParallelFor is a worker too, so one thread less is spawned.
+    for (std::size_t index = 0; index + 1 < count; ++index) {
+        queues_.emplace_back(new Queue{});
+    }
+    for (std::size_t index = 0; index + 1 < count; ++index) {
+        threads_.emplace_back(&ThreadPool::WorkerLoop, this, index);
+    }
+}
+
+void ThreadPool::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+    threads_.clear();
+    queues_.clear();
+    stop_ = false;
+    worker_count_ = 1;
+}
+
+void ThreadPool::WorkerLoop(std::size_t index) {
+    tls_pool = this;
+    tls_queue = index;
+
+    while (true) {
+        Task task{};
+        if (PopOrSteal(index, task)) {
+            Run(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        wake_.wait(lock, [this] { return stop_ || (queued_.load() > 0); });
+        if (stop_ && (queued_.load() == 0)) {
+            return;
+        }
+    }
+}
+
+bool ThreadPool::PopOrSteal(std::size_t home, Task& task) {
+    if (queues_.empty() || (queued_.load() == 0)) {
+        return false;
+    }
+
+    // LIFO from the own queue keeps recently split work cache-hot, FIFO steals take the largest pending pieces.
+    const std::size_t count = queues_.size();
+    for (std::size_t offset = 0; offset < count; ++offset) {
+        Queue& queue = *queues_[(home + offset) % count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.size == 0) {
+            continue;
+        }
+        task = (offset == 0) ? queue.PopBack() : queue.PopFront();
+        queued_.fetch_sub(1);
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::Run(const Task& task) {
+    Job& job = *task.job;
+    try {
+        (*job.body)(task.first, task.last);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(job.mutex);
+        if (!job.error) {
+            job.error = std::current_exception();
+        }
+    }
+
+    // The owner may destroy the job as soon as pending reaches zero, so it is only touched under the lock.
+    std::lock_guard<std::mutex> lock(job.mutex);
+    if (job.pending.fetch_sub(1) == 1) {
+        job.done.notify_all();
+    }
+}
+
+bool ThreadPool::ShouldSplit(std::size_t range, std::size_t work_per_index) const {
+    const std::size_t threshold = SerialThreshold();
+    const bool small = (work_per_index == 0) || ((threshold > 0) && (range <= (threshold - 1) / work_per_index));
+    return !queues_.empty() && (range >= 2) && !small;
+}
+
+void ThreadPool::Dispatch(std::size_t begin, std::size_t end, const RangeFunction& body) {
+    const std::size_t range = end - begin;
+    const std::size_t chunks = std::min(range, worker_count_ * kChunksPerWorker);
+    const std::size_t home =
+        (tls_pool == this) ? tls_queue : (next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size());
+
+    Job job{};
+    job.body = &body;
+    job.pending.store(chunks);
+
+    // Counted before they are pushed, so a worker that pops a chunk at once never takes queued_ below zero.
+    queued_.fetch_add(chunks);
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+        Task task{&job, begin + range * chunk / chunks, begin + range * (chunk + 1) / chunks};
+        Queue& queue = *queues_[(home + chunk) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.PushBack(task);
+    }
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+    }
+    wake_.notify_all();
+
+    // Help until every chunk of this job has finished. Chunks of other (nested) jobs may be run meanwhile.
+    while (job.pending.load() > 0) {
+        Task task{};
+        if (PopOrSteal(home, task)) {
+            Run(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(job.mutex);
+        job.done.wait_for(lock, std::chrono::microseconds(200), [&job] { return job.pending.load() == 0; });
+    }
+
+    std::lock_guard<std::mutex> lock(job.mutex);
+    if (job.error) {
+        std::rethrow_exception(job.error);
+    }
+}
+
+}  // namespace parallel
+}  // namespace math_cpp
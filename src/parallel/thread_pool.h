@@ -0,0 +1,139 @@
+/// @file thread_pool.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief Library-owned work-stealing thread pool.
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef SRC_PARALLEL_THREAD_POOL_H_
+#define SRC_PARALLEL_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace math_cpp {
+namespace parallel {
+
+/// @brief Non-owning reference to the body of a parallel loop, which is called with a half-open index range
+/// [first, last). Unlike std::function it never allocates, the body must outlive the reference.
+class RangeFunction {
+ public:
+    template <typename Body>
+    explicit RangeFunction(Body& body)
+        : object_(const_cast<void*>(static_cast<const void*>(&body))), call_(&Call<Body>) {}
+
+    void operator()(std::size_t first, std::size_t last) const { call_(object_, first, last); }
+
+ private:
+    template <typename Body>
+    static void Call(void* object, std::size_t first, std::size_t last) {
+        (*static_cast<Body*>(object))(first, last);
+    }
+
+    void* object_;
+    void (*call_)(void*, std::size_t, std::size_t);
+};
+
+class ThreadPool {
+ public:
+    static ThreadPool& GetInstance();
+
+    ~ThreadPool();
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool(ThreadPool&& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ThreadPool& operator=(ThreadPool&& other) = delete;
+
+    /// @brief Number of threads that execute a parallel loop, including the calling thread.
+    std::size_t WorkerCount() const;
+
+    /// @brief Restarts the pool with count threads. 0 selects MATH_CPP_NUM_THREADS or the hardware concurrency.
+    /// Must not be called while a parallel loop is running.
+    void SetWorkerCount(std::size_t count);
+
+    /// @brief Loops whose total work is below this value run serially on the calling thread.
+    std::size_t SerialThreshold() const;
+    void SetSerialThreshold(std::size_t work);
+
+    /// @brief Splits [begin, end) into chunks and runs body on them in parallel. The calling thread takes part and
+    /// returns once every chunk is done. The first exception thrown by body is rethrown here.
+    /// @param work_per_index Estimated cost of one index (e.g. flops), compared against SerialThreshold().
+    /// A loop that runs serially calls body directly, so it neither allocates nor goes through an indirect call.
+    template <typename Body>
+    void ParallelFor(std::size_t begin, std::size_t end, std::size_t work_per_index, Body&& body) {
+        if (begin >= end) {
+            return;
+        }
+        if (!ShouldSplit(end - begin, work_per_index)) {
+            body(begin, end);
+            return;
+        }
+        Dispatch(begin, end, RangeFunction(body));
+    }
+
+ private:
+    struct Job;
+    struct Task {
+        Job* job{nullptr};
+        std::size_t first{};
+        std::size_t last{};
+    };
+    /// Double-ended task queue on a ring buffer that only grows. std::deque frees and allocates blocks as it drains
+    /// and refills, which would allocate in every split loop.
+    struct Queue {
+        std::mutex mutex{};
+        std::vector<Task> ring{};
+        std::size_t head{};
+        std::size_t size{};
+
+        void PushBack(const Task& task);
+        Task PopBack();
+        Task PopFront();
+    };
+
+    ThreadPool();
+
+    bool ShouldSplit(std::size_t range, std::size_t work_per_index) const;
+    /// Splits the loop into tasks and helps run them until all are done.
+    void Dispatch(std::size_t begin, std::size_t end, const RangeFunction& body);
+
+    void Start(std::size_t count);
+    void Stop();
+    void WorkerLoop(std::size_t index);
+
+    bool PopOrSteal(std::size_t home, Task& task);
+    static void Run(const Task& task);
+
+    std::vector<std::unique_ptr<Queue>> queues_{};
+    std::vector<std::thread> threads_{};
+
+    std::mutex wake_mutex_{};
+    std::condition_variable wake_{};
+    /// Tasks in the queues. Raised before a push and lowered after a pop, so it may overcount but never undercounts.
+    std::atomic<std::size_t> queued_{0};
+    std::atomic<std::size_t> next_queue_{0};
+    bool stop_{false};
+
+    std::size_t worker_count_{1};
+    std::atomic<std::size_t> serial_threshold_{};
+};
+
+/// @brief ThreadPool::GetInstance().ParallelFor(begin, end, work_per_index, body)
+template <typename Body>
+void ParallelFor(std::size_t begin, std::size_t end, std::size_t work_per_index, Body&& body) {
+    ThreadPool::GetInstance().ParallelFor(begin, end, work_per_index, std::forward<Body>(body));
+}
+
+}  // namespace parallel
+}  // namespace math_cpp
+
+#endif  // SRC_PARALLEL_THREAD_POOL_H_
@@ -10,28 +10,417 @@
 
 #include "src/random/random.h"
 
-#include <cstdlib>
-#include <ctime>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "src/matrix/matrix_simd.h"
+#include "src/parallel/thread_pool.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MATH_CPP_SIMD_X86
+#include <immintrin.h>
+#endif
 
 namespace math_cpp {
 namespace random {
+
+namespace {
+std::uint64_t RotateLeft(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+std::uint64_t SplitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+std::uint64_t RandomDeviceSeed() {
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) ^ static_cast<std::uint64_t>(device());
+}
+
+std::atomic<std::uint64_t>& GlobalSeed() {
+    static std::atomic<std::uint64_t> seed{RandomDeviceSeed()};
+    return seed;
+}
+
+// 2^-53, the spacing of doubles in [0.5, 1).
+constexpr double kUnit = 1.0 / static_cast<double>(1ULL << 53);
+
+// Bumped by SetSeed, a thread generator made in an older epoch is rebuilt before its next use.
+std::atomic<std::uint64_t> seed_epoch{0};
+std::atomic<std::uint64_t> next_stream{0};
+
+// Elements per block of the bulk fills. Blocks are the unit of seeding, so this value is part of the output.
+constexpr std::size_t kFillBlock = 1 << 16;
+constexpr std::size_t kLanes = 8;
+// Words generated per refill, converted in one vectorizable loop.
+constexpr std::size_t kBufferWords = 256;
+
+/// Top 52 bits as a double in [0, 1). Built from the exponent bits of 1.0 instead of an integer conversion, which has
+/// no packed form before AVX-512, so the conversion loops vectorize.
+double ToUnit(std::uint64_t bits) {
+    const std::uint64_t one = (bits >> 12) | 0x3ff0000000000000ULL;
+    double result = 0.0;
+    std::memcpy(&result, &one, sizeof(result));
+    return result - 1.0;
+}
+
+// The bulk fills run kLanes xoshiro256+ engines side by side, state word k of lane l at state[k * kLanes + l].
+// xoshiro256+ is the variant meant for floating point numbers: it has no multiplication, which SIMD units lack for 64
+// bits, and only its lowest bits are weak, which the conversions drop. Every kernel writes the same words.
+using RefillKernel = void (*)(std::uint64_t* state, std::uint64_t* words);
+
+void RefillScalar(std::uint64_t* state, std::uint64_t* words) {
+    std::uint64_t* s0 = state;
+    std::uint64_t* s1 = state + kLanes;
+    std::uint64_t* s2 = state + 2 * kLanes;
+    std::uint64_t* s3 = state + 3 * kLanes;
+    for (std::size_t i = 0; i < kBufferWords; i += kLanes) {
+        for (std::size_t lane = 0; lane < kLanes; ++lane) {
+            words[i + lane] = s0[lane] + s3[lane];
+            const std::uint64_t t = s1[lane] << 17;
+            s2[lane] ^= s0[lane];
+            s3[lane] ^= s1[lane];
+            s1[lane] ^= s2[lane];
+            s0[lane] ^= s3[lane];
+            s2[lane] ^= t;
+            s3[lane] = RotateLeft(s3[lane], 45);
+        }
+    }
+}
+
+#ifdef MATH_CPP_SIMD_X86
+__attribute__((target("avx2"))) void RefillAVX2(std::uint64_t* state, std::uint64_t* words) {
+    // Lanes 0 - 3 and 4 - 7 in two registers per state word.
+    __m256i s[4][2];
+    for (std::size_t k = 0; k < 4; ++k) {
+        for (std::size_t h = 0; h < 2; ++h) {
+            s[k][h] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state + k * kLanes + h * 4));
+        }
+    }
+    for (std::size_t i = 0; i < kBufferWords; i += kLanes) {
+        for (std::size_t h = 0; h < 2; ++h) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(words + i + h * 4), _mm256_add_epi64(s[0][h], s[3][h]));
+            const __m256i t = _mm256_slli_epi64(s[1][h], 17);
+            s[2][h] = _mm256_xor_si256(s[2][h], s[0][h]);
+            s[3][h] = _mm256_xor_si256(s[3][h], s[1][h]);
+            s[1][h] = _mm256_xor_si256(s[1][h], s[2][h]);
+            s[0][h] = _mm256_xor_si256(s[0][h], s[3][h]);
+            s[2][h] = _mm256_xor_si256(s[2][h], t);
+            s[3][h] = _mm256_or_si256(_mm256_slli_epi64(s[3][h], 45), _mm256_srli_epi64(s[3][h], 19));
+        }
+    }
+    for (std::size_t k = 0; k < 4; ++k) {
+        for (std::size_t h = 0; h < 2; ++h) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(state + k * kLanes + h * 4), s[k][h]);
+        }
+    }
+}
+
+__attribute__((target("avx512f"))) void RefillAVX512(std::uint64_t* state, std::uint64_t* words) {
+    __m512i s0 = _mm512_loadu_si512(state);
+    __m512i s1 = _mm512_loadu_si512(state + kLanes);
+    __m512i s2 = _mm512_loadu_si512(state + 2 * kLanes);
+    __m512i s3 = _mm512_loadu_si512(state + 3 * kLanes);
+    // The masked shift and rotate with a full mask are the plain ones, the unmasked intrinsics trip
+    // -Wuninitialized inside the GCC 12 headers.
+    const __mmask8 all = 0xff;
+    for (std::size_t i = 0; i < kBufferWords; i += kLanes) {
+        _mm512_storeu_si512(words + i, _mm512_add_epi64(s0, s3));
+        const __m512i t = _mm512_mask_slli_epi64(s1, all, s1, 17);
+        s2 = _mm512_xor_si512(s2, s0);
+        s3 = _mm512_xor_si512(s3, s1);
+        s1 = _mm512_xor_si512(s1, s2);
+        s0 = _mm512_xor_si512(s0, s3);
+        s2 = _mm512_xor_si512(s2, t);
+        s3 = _mm512_mask_rol_epi64(s3, all, s3, 45);
+    }
+    _mm512_storeu_si512(state, s0);
+    _mm512_storeu_si512(state + kLanes, s1);
+    _mm512_storeu_si512(state + 2 * kLanes, s2);
+    _mm512_storeu_si512(state + 3 * kLanes, s3);
+}
+#endif  // MATH_CPP_SIMD_X86
+
+RefillKernel ActiveRefill() {
+#ifdef MATH_CPP_SIMD_X86
+    switch (matrix::simd::ActiveIsa()) {
+        case matrix::simd::Isa::kAVX512:
+            return RefillAVX512;
+        case matrix::simd::Isa::kAVX2:
+            return RefillAVX2;
+        case matrix::simd::Isa::kSSE2:
+        case matrix::simd::Isa::kScalar:
+            break;
+    }
+#endif
+    return RefillScalar;
+}
+
+class BitBuffer {
+ public:
+    explicit BitBuffer(std::uint64_t seed) : refill_(ActiveRefill()) {
+        for (auto& word : state_) {
+            word = SplitMix64(seed);
+        }
+    }
+
+    /// Fresh words for the caller, Next() does not hand them out again.
+    const std::uint64_t* Refill() {
+        refill_(state_, words_);
+        next_ = kBufferWords;
+        return words_;
+    }
+
+    std::uint64_t Next() {
+        if (next_ == kBufferWords) {
+            refill_(state_, words_);
+            next_ = 0;
+        }
+        return words_[next_++];
+    }
+
+ private:
+    RefillKernel refill_;
+    alignas(64) std::uint64_t state_[4 * kLanes]{};
+    alignas(64) std::uint64_t words_[kBufferWords]{};
+    std::size_t next_{kBufferWords};
+};
+
+struct ZigguratTable {
+    static constexpr std::size_t kLayers = 128;
+    // Start of the tail, and the area of every layer.
+    static constexpr double kTail = 3.442619855899;
+    static constexpr double kArea = 9.91256303526217e-3;
+
+    /// Right edge of layer i, x[0] is the virtual edge of the base layer that includes the tail.
+    double x[kLayers + 1];
+    /// x[i + 1] / x[i], a sample below it lies inside the next narrower layer, no density test needed.
+    double ratio[kLayers];
+
+    ZigguratTable() {
+        double f = std::exp(-0.5 * kTail * kTail);
+        x[0] = kArea / f;
+        x[1] = kTail;
+        x[kLayers] = 0.0;
+        for (std::size_t i = 2; i < kLayers; ++i) {
+            x[i] = std::sqrt(-2.0 * std::log(kArea / x[i - 1] + f));
+            f = std::exp(-0.5 * x[i] * x[i]);
+        }
+        for (std::size_t i = 0; i < kLayers; ++i) {
+            ratio[i] = x[i + 1] / x[i];
+        }
+    }
+};
+
+const ZigguratTable& Ziggurat() {
+    static const ZigguratTable table{};
+    return table;
+}
+
+/// Uniform in (0, 1), never 0, for the logarithms of the tail. Shifts the 2^-52 grid of ToUnit by half a step.
+double OpenUnit(BitBuffer& bits) { return ToUnit(bits.Next()) + kUnit; }
+
+/// Second stage for a sample x = u * x[layer] outside the rectangle of its layer: the tail beyond kTail for the base
+/// layer, the wedge under the density otherwise. Returns false if the sample is rejected.
+bool ZigguratEdge(const ZigguratTable& table, std::size_t layer, double x, BitBuffer& bits, double& result) {
+    if (layer == 0) {
+        // Marsaglia's tail algorithm.
+        double tail = 0.0;
+        double y = 0.0;
+        do {
+            tail = std::log(OpenUnit(bits)) / ZigguratTable::kTail;
+            y = std::log(OpenUnit(bits));
+        } while (-2.0 * y < tail * tail);
+        result = (x < 0.0) ? tail - ZigguratTable::kTail : ZigguratTable::kTail - tail;
+        return true;
+    }
+    const double f0 = std::exp(-0.5 * (table.x[layer] * table.x[layer] - x * x));
+    const double f1 = std::exp(-0.5 * (table.x[layer + 1] * table.x[layer + 1] - x * x));
+    result = x;
+    return f1 + ToUnit(bits.Next()) * (f0 - f1) < 1.0;
+}
+
+/// One sample per word: the top 52 bits give u in [-1, 1), bits 4 - 10 the layer.
+double ZigguratCandidate(const ZigguratTable& table, std::uint64_t word, std::size_t& layer, bool& inside) {
+    const double u = 2.0 * ToUnit(word) - 1.0;
+    layer = (word >> 4) & (ZigguratTable::kLayers - 1);
+    inside = std::abs(u) < table.ratio[layer];
+    return u * table.x[layer];
+}
+
+double ZigguratGaussian(const ZigguratTable& table, BitBuffer& bits) {
+    for (;;) {
+        std::size_t layer = 0;
+        bool inside = false;
+        const double x = ZigguratCandidate(table, bits.Next(), layer, inside);
+        double result = x;
+        if (inside || ZigguratEdge(table, layer, x, bits, result)) {
+            return result;
+        }
+    }
+}
+
+/// Runs fill(seed, first, count) for every block of [0, size), in parallel. The seeds are drawn up front in block
+/// order, so the output does not depend on the scheduling.
+template <typename Fill>
+void FillBlocks(Random& generator, std::size_t size, std::size_t work_per_element, const Fill& fill) {
+    const std::size_t blocks = (size + kFillBlock - 1) / kFillBlock;
+    std::vector<std::uint64_t> seeds(blocks);
+    for (auto& seed : seeds) {
+        seed = generator.Engine()();
+    }
+    parallel::ParallelFor(0, blocks, kFillBlock * work_per_element, [&](std::size_t first, std::size_t last) {
+        for (std::size_t block = first; block < last; ++block) {
+            const std::size_t begin = block * kFillBlock;
+            fill(seeds[block], begin, std::min(kFillBlock, size - begin));
+        }
+    });
+}
+}  // namespace
+
+Xoshiro256::Xoshiro256(std::uint64_t seed) {
+    for (auto& word : state_) {
+        word = SplitMix64(seed);
+    }
+}
+
+Xoshiro256::result_type Xoshiro256::operator()() {
+    const std::uint64_t result = RotateLeft(state_[1] * 5, 7) * 9;
+    const std::uint64_t t = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = RotateLeft(state_[3], 45);
+    return result;
+}
+
+void Xoshiro256::Jump() {
+    Jump({0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL});
+}
+
+void Xoshiro256::LongJump() {
+    Jump({0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL});
+}
+
+void Xoshiro256::Jump(const std::array<std::uint64_t, 4>& polynomial) {
+    std::array<std::uint64_t, 4> jumped{};
+    for (std::uint64_t word : polynomial) {
+        for (int bit = 0; bit < 64; ++bit) {
+            if ((word & (1ULL << bit)) != 0) {
+                for (std::size_t i = 0; i < jumped.size(); ++i) {
+                    jumped[i] ^= state_[i];
+                }
+            }
+            (*this)();
+        }
+    }
+    state_ = jumped;
+}
+
 Random& Random::GetInstance() {
-    static Random instance{};
+    thread_local std::uint64_t epoch = seed_epoch.load();
+    thread_local Random instance{GlobalSeed().load(), next_stream.fetch_add(1)};
 
+    const std::uint64_t current = seed_epoch.load();
+    if (epoch != current) {
+        epoch = current;
+        instance = Random(GlobalSeed().load(), next_stream.fetch_add(1));
+    }
     return instance;
 }
 
+void Random::SetSeed(std::uint64_t seed) {
+    GlobalSeed().store(seed);
+    next_stream.store(0);
+    seed_epoch.fetch_add(1);
+}
+
+Random::Random(std::uint64_t seed, std::uint64_t stream) : engine_(seed) {
+    for (std::uint64_t i = 0; i < stream; ++i) {
+        engine_.Jump();
+    }
+}
+
 double Random::Uniform(double min, double max) {
-    std::uniform_real_distribution<> dis(min, max);
-    return dis(generator_);
+    // The top 53 bits fill the mantissa, so every value is a multiple of 2^-53 in [0, 1).
+    const double unit = static_cast<double>(engine_() >> 11) * kUnit;
+    return min + (max - min) * unit;
 }
 
 double Random::Gaussian(double mean, double std) {
-    std::normal_distribution<> dis(mean, std);
-    return dis(generator_);
+    if (has_spare_) {
+        has_spare_ = false;
+        return mean + std * spare_;
+    }
+    double u = 0.0;
+    double v = 0.0;
+    double s = 0.0;
+    do {
+        u = Uniform(-1.0, 1.0);
+        v = Uniform(-1.0, 1.0);
+        s = u * u + v * v;
+    } while ((s >= 1.0) || (s == 0.0));
+    const double scale = std::sqrt(-2.0 * std::log(s) / s);
+    spare_ = v * scale;
+    has_spare_ = true;
+    return mean + std * u * scale;
 }
 
-Random::Random() : generator_{(std::random_device())()} {}
+Xoshiro256& Random::Engine() { return engine_; }
+
+void FillUniform(Random& generator, double* out, std::size_t size, double min, double max) {
+    const double scale = max - min;
+    FillBlocks(generator, size, 2, [=](std::uint64_t seed, std::size_t begin, std::size_t count) {
+        BitBuffer bits(seed);
+        for (std::size_t i = 0; i < count; i += kBufferWords) {
+            const std::uint64_t* words = bits.Refill();
+            const std::size_t chunk = std::min(kBufferWords, count - i);
+            double* dst = out + begin + i;
+            for (std::size_t k = 0; k < chunk; ++k) {
+                dst[k] = min + scale * ToUnit(words[k]);
+            }
+        }
+    });
+}
+
+void FillGaussian(Random& generator, double* out, std::size_t size, double mean, double std) {
+    const ZigguratTable& table = Ziggurat();
+    FillBlocks(generator, size, 4, [=, &table](std::uint64_t seed, std::size_t begin, std::size_t count) {
+        BitBuffer bits(seed);
+        std::size_t edges[kBufferWords];
+        std::size_t layers[kBufferWords];
+        for (std::size_t i = 0; i < count; i += kBufferWords) {
+            const std::uint64_t* words = bits.Refill();
+            const std::size_t chunk = std::min(kBufferWords, count - i);
+            double* dst = out + begin + i;
+            // Without branches: every candidate is stored, the few outside their rectangle are listed for later.
+            std::size_t edge_count = 0;
+            for (std::size_t k = 0; k < chunk; ++k) {
+                bool inside = false;
+                dst[k] = ZigguratCandidate(table, words[k], layers[edge_count], inside);
+                edges[edge_count] = k;
+                edge_count += inside ? 0 : 1;
+            }
+            for (std::size_t e = 0; e < edge_count; ++e) {
+                double& value = dst[edges[e]];
+                if (!ZigguratEdge(table, layers[e], value, bits, value)) {
+                    value = ZigguratGaussian(table, bits);
+                }
+            }
+            for (std::size_t k = 0; k < chunk; ++k) {
+                dst[k] = mean + std * dst[k];
+            }
+        }
+    });
+}
 
 }  // namespace random
 }  // namespace math_cpp
@@ -11,25 +11,81 @@
 #ifndef SRC_RANDOM_RANDOM_H_
 #define SRC_RANDOM_RANDOM_H_
 
+#include <array>
 #include <cstddef>
-#include <random>
+#include <cstdint>
+#include <limits>
 
 namespace math_cpp {
 namespace random {
 
+/// @brief xoshiro256** engine (Blackman and Vigna), period 2^256 - 1. Satisfies UniformRandomBitGenerator, so it also
+/// works with the <random> distributions. Jump() advances by 2^128 draws, which splits one seed into 2^128
+/// non-overlapping streams.
+class Xoshiro256 {
+ public:
+    using result_type = std::uint64_t;
+
+    /// @brief The 256-bit state is expanded from seed with SplitMix64, so nearby seeds give unrelated states.
+    explicit Xoshiro256(std::uint64_t seed);
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+    result_type operator()();
+
+    /// @brief Same as 2^128 calls of operator().
+    void Jump();
+    /// @brief Same as 2^192 calls of operator(), to split streams once more.
+    void LongJump();
+
+ private:
+    void Jump(const std::array<std::uint64_t, 4>& polynomial);
+
+    std::array<std::uint64_t, 4> state_{};
+};
+
+/// @brief Uniform and Gaussian numbers from a Xoshiro256 stream. The conversions are done here rather than by the
+/// <random> distributions, whose output differs between standard libraries, so a seed gives the same numbers on every
+/// platform. A Random is not shared between threads, use one per thread or per stream.
 class Random {
  public:
+    /// @brief Generator of the calling thread. Threads never share it, so it is safe without locks. Each thread draws
+    /// from its own stream of the global seed, numbered in the order the threads first call GetInstance.
     static Random& GetInstance();
 
+    /// @brief Reseeds every thread generator, on their next GetInstance call. Until it is called the global seed
+    /// comes from std::random_device. Thread streams are renumbered from 0, so a single-threaded program repeats
+    /// its sequence after each SetSeed with the same value.
+    static void SetSeed(std::uint64_t seed);
+
+    /// @brief Stream `stream` of seed, i.e. the engine of seed jumped stream times. Streams of one seed never overlap,
+    /// so a parallel job that gives task i the stream i is reproducible regardless of the thread that runs it.
+    explicit Random(std::uint64_t seed, std::uint64_t stream = 0);
+
+    /// @brief Uniform in [min, max), with 53 random bits.
     double Uniform(double min = 0.0, double max = 1.0);
+    /// @brief Normal distribution by the Marsaglia polar method, every other call uses the cached second value.
     double Gaussian(double mean = 0.0, double std = 1.0);
 
- private:
-    Random();
+    Xoshiro256& Engine();
 
-    std::mt19937 generator_{};
+ private:
+    Xoshiro256 engine_;
+    double spare_{};
+    bool has_spare_{false};
 };
 
+/// @brief Writes size uniform numbers in [min, max) to out, with 52 random bits. The buffer is cut into fixed blocks
+/// that are filled in parallel, each by eight interleaved xoshiro256+ engines stepped with AVX2 or AVX-512 when the CPU
+/// has them. Every block is seeded by one draw of generator, so the numbers depend on the generator state only, not on
+/// the thread count or the instruction set.
+void FillUniform(Random& generator, double* out, std::size_t size, double min = 0.0, double max = 1.0);
+
+/// @brief Writes size normal numbers to out, blocked and seeded like FillUniform. Uses the ziggurat method (Marsaglia
+/// and Tsang, with the 128 layers of Doornik's ZIGNOR): about 98% of the samples cost one draw, a multiply and a
+/// compare.
+void FillGaussian(Random& generator, double* out, std::size_t size, double mean = 0.0, double std = 1.0);
+
 }  // namespace random
 }  // namespace math_cpp
 
@@ -0,0 +1,91 @@
+/// @file matrix_batch_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_batch.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+using matrix::MatrixBatch;
+
+namespace {
+// More than one tile of lanes, with a partial tile at the end.
+constexpr std::size_t kCount = 70;
+
+MatrixBatch MakeRandomBatch(std::size_t count, std::size_t row, std::size_t col) {
+    MatrixBatch batch(count, row, col);
+    for (std::size_t i = 0; i < count; ++i) {
+        batch.Set(i, Matrix::Random(row, col));
+    }
+    return batch;
+}
+}  // namespace
+
+TEST(MatrixBatchTest, LayoutCase) {
+    MatrixBatch batch(3, 2, 2);
+    Matrix A{{1.0, 2.0}, {3.0, 4.0}};
+    batch.Set(1, A);
+
+    EXPECT_EQ(A, batch.Get(1));
+    EXPECT_EQ(Matrix(2, 2), batch.Get(0));
+    EXPECT_EQ(2.0, batch.ElementData(0, 1)[1]);
+    EXPECT_EQ(3.0, batch(1, 1, 0));
+
+    EXPECT_THROW(batch.Get(3), std::invalid_argument);
+    EXPECT_THROW(batch.Set(0, Matrix(3, 2)), std::invalid_argument);
+}
+
+TEST(MatrixBatchTest, BatchGemmCase) {
+    MatrixBatch a = MakeRandomBatch(kCount, 4, 6);
+    MatrixBatch b = MakeRandomBatch(kCount, 6, 5);
+    MatrixBatch c = MakeRandomBatch(kCount, 4, 5);
+    MatrixBatch original = c;
+
+    matrix::BatchGemm(2.0, a, b, 0.5, c);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        Matrix expect = 2.0 * a.Get(i) * b.Get(i) + 0.5 * original.Get(i);
+        EXPECT_EQ(expect, c.Get(i));
+    }
+
+    EXPECT_THROW(matrix::BatchGemm(1.0, a, a, 0.0, c), std::invalid_argument);
+}
+
+TEST(MatrixBatchTest, BatchInverseSolveCase) {
+    for (std::size_t n : {4U, 13U, 32U}) {
+        MatrixBatch a = MakeRandomBatch(kCount, n, n);
+        MatrixBatch b = MakeRandomBatch(kCount, n, 2);
+
+        MatrixBatch inverse{};
+        MatrixBatch x{};
+        matrix::BatchInverse(a, inverse);
+        matrix::BatchSolve(a, b, x);
+        for (std::size_t i = 0; i < kCount; ++i) {
+            EXPECT_EQ(a.Get(i).Inverse(), inverse.Get(i));
+            EXPECT_EQ(b.Get(i), a.Get(i) * x.Get(i));
+        }
+    }
+
+    MatrixBatch singular(3, 2, 2);
+    singular.Set(0, Matrix::Identity(2));
+    singular.Set(2, Matrix::Identity(2));
+    MatrixBatch inverse{};
+    EXPECT_THROW(matrix::BatchInverse(singular, inverse), std::invalid_argument);
+    EXPECT_THROW(matrix::BatchInverse(MatrixBatch(2, 2, 3), inverse), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace math_cpp
@@ -0,0 +1,151 @@
+/// @file matrix_cholesky_solver_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_cholesky_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::CholeskySolver;
+using matrix::LDLTSolver;
+using matrix::Matrix;
+
+namespace {
+bool IsLowerTriangular(const Matrix& mat) {
+    for (std::size_t r = 0; r < mat.Row(); ++r) {
+        for (std::size_t c = r + 1; c < mat.Col(); ++c) {
+            if (mat(r, c) != 0.0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
+TEST(CholeskySolverTest, FactorsCase) {
+    // 150 spans three panels, so the blocked trailing update is covered.
+    Matrix A = MakeSymmetricPositiveDefinite(150);
+    CholeskySolver solver(A);
+    ASSERT_TRUE(solver.IsPositiveDefinite());
+
+    Matrix L = solver.Lower();
+    EXPECT_TRUE(IsLowerTriangular(L));
+    EXPECT_EQ(A, L * L.Transpose());
+
+    Eigen::LLT<Eigen::MatrixXd> expect(MakeEigenMatrix(A));
+    Matrix B = Matrix::Random(150, 3);
+    EXPECT_TRUE(expect.solve(MakeEigenMatrix(B)) == solver.Solve(B));
+    EXPECT_EQ(Matrix::Identity(150), A * solver.Inverse());
+
+    const double log_det = 2.0 * expect.matrixLLT().diagonal().array().log().sum();
+    EXPECT_EQ(1.0, solver.LogDeterminant().first);
+    EXPECT_NEAR(log_det, solver.LogDeterminant().second, 1e-8 * std::abs(log_det));
+
+    Matrix small{{4.0, 2.0}, {2.0, 3.0}};
+    EXPECT_NEAR(8.0, CholeskySolver(small).Determinant(), 1e-12);
+}
+
+TEST(CholeskySolverTest, NotPositiveDefiniteCase) {
+    Matrix A{{1.0, 2.0}, {2.0, 1.0}};
+    CholeskySolver solver(A);
+
+    EXPECT_FALSE(solver.IsPositiveDefinite());
+    EXPECT_THROW(solver.Solve(Matrix(2, 1)), std::invalid_argument);
+    EXPECT_THROW(solver.LogDeterminant(), std::invalid_argument);
+    EXPECT_THROW(CholeskySolver(Matrix(2, 3)), std::invalid_argument);
+}
+
+TEST(CholeskySolverTest, UpdateCase) {
+    Matrix A = MakeSymmetricPositiveDefinite(100);
+    Matrix x = Matrix::Random(100, 1);
+    CholeskySolver solver(A);
+
+    solver.Update(x);
+    Matrix updated = A + x * x.Transpose();
+    Matrix L = solver.Lower();
+    EXPECT_TRUE(IsLowerTriangular(L));
+    EXPECT_EQ(updated, L * L.Transpose());
+    EXPECT_EQ(CholeskySolver(updated).Lower(), L);
+
+    solver.Downdate(x);
+    L = solver.Lower();
+    EXPECT_EQ(A, L * L.Transpose());
+
+    // A - y * y^T is indefinite when y is large, the factor must survive the failed downdate.
+    Matrix y = x * 100.0;
+    EXPECT_THROW(solver.Downdate(y), std::invalid_argument);
+    EXPECT_TRUE(solver.IsPositiveDefinite());
+    EXPECT_EQ(L, solver.Lower());
+    EXPECT_THROW(solver.Update(Matrix(3, 1)), std::invalid_argument);
+}
+
+TEST(LDLTSolverTest, QuasiDefiniteCase) {
+    // [P B^T; B -Q] with P, Q positive definite has no zero pivot in any order, but is indefinite.
+    const std::size_t p = 90;
+    const std::size_t q = 40;
+    Matrix A(p + q, p + q);
+    Matrix B = Matrix::Random(q, p);
+    Matrix negative_definite = MakeSymmetricPositiveDefinite(q) * -1.0;
+    matrix::kernel::Copy(MakeSymmetricPositiveDefinite(p), A.Block(0, 0, p, p));
+    matrix::kernel::Copy(negative_definite, A.Block(p, p, q, q));
+    matrix::kernel::Copy(B, A.Block(p, 0, q, p));
+    matrix::kernel::Copy(B.Transpose(), A.Block(0, p, p, q));
+
+    LDLTSolver solver(A);
+    ASSERT_FALSE(solver.IsSingular());
+
+    Matrix L = solver.Lower();
+    Matrix D = solver.Diagonal();
+    EXPECT_TRUE(IsLowerTriangular(L));
+    for (std::size_t i = 0; i < L.Row(); ++i) {
+        EXPECT_EQ(1.0, L(i, i));
+    }
+    Matrix LD = L;
+    for (std::size_t c = 0; c < LD.Col(); ++c) {
+        for (std::size_t r = 0; r < LD.Row(); ++r) {
+            LD(r, c) *= D(c, 0);
+        }
+    }
+    EXPECT_EQ(A, LD * L.Transpose());
+
+    std::size_t negative = 0;
+    for (std::size_t i = 0; i < D.Row(); ++i) {
+        negative += (D(i, 0) < 0.0) ? 1 : 0;
+    }
+    EXPECT_EQ(q, negative);
+
+    Eigen::PartialPivLU<Eigen::MatrixXd> expect(MakeEigenMatrix(A));
+    Matrix b = Matrix::Random(p + q, 1);
+    EXPECT_TRUE(expect.solve(MakeEigenMatrix(b)) == solver.Solve(b));
+    EXPECT_EQ(Matrix::Identity(p + q), A * solver.Inverse());
+
+    const auto log_det = solver.LogDeterminant();
+    EXPECT_EQ((q % 2 == 0) ? 1.0 : -1.0, log_det.first);
+    const double expect_log = expect.matrixLU().diagonal().array().abs().log().sum();
+    EXPECT_NEAR(expect_log, log_det.second, 1e-8 * std::abs(expect_log));
+
+    LDLTSolver singular(Matrix{{0.0, 1.0}, {1.0, 0.0}});
+    EXPECT_TRUE(singular.IsSingular());
+    EXPECT_EQ(0.0, singular.Determinant());
+    EXPECT_THROW(singular.Solve(Matrix(2, 1)), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace math_cpp
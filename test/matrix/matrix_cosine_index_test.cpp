@@ -0,0 +1,95 @@
+/// @file matrix_cosine_index_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_cosine_index.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "src/matrix/matrix.h"
+#include "src/parallel/thread_pool.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::CosineIndex;
+using matrix::Matrix;
+
+TEST(CosineIndexTest, BruteForceCase) {
+    // Several corpus blocks, so several parts when there are several workers.
+    Matrix corpus = Matrix::Random(3000, 24);
+    Matrix queries = Matrix::Random(5, 24);
+    CosineIndex index(corpus);
+    EXPECT_EQ(3000U, index.Size());
+    EXPECT_EQ(24U, index.Dimension());
+
+    const std::size_t k = 7;
+    CosineIndex::Neighbors neighbors = index.Search(queries, k);
+    ASSERT_EQ(5U, neighbors.scores.Row());
+    ASSERT_EQ(k, neighbors.scores.Col());
+    ASSERT_EQ(5U * k, neighbors.indices.size());
+
+    for (std::size_t i = 0; i < 5; ++i) {
+        std::vector<double> expect(3000);
+        for (std::size_t r = 0; r < 3000; ++r) {
+            expect[r] = matrix::Util::CosineSimilarity(queries.GetRow(i), corpus.GetRow(r));
+        }
+        std::vector<std::size_t> order(3000);
+        std::iota(std::begin(order), std::end(order), 0);
+        std::partial_sort(std::begin(order), std::begin(order) + k, std::end(order),
+                          [&expect](std::size_t lhs, std::size_t rhs) { return expect[lhs] > expect[rhs]; });
+        for (std::size_t j = 0; j < k; ++j) {
+            EXPECT_EQ(order[j], neighbors.indices[i * k + j]);
+            EXPECT_NEAR(expect[order[j]], neighbors.scores(i, j), 1e-12);
+        }
+    }
+}
+
+TEST(CosineIndexTest, WorkerCountCase) {
+    // The corpus is split into parts only with several workers, the result must not change.
+    Matrix corpus = Matrix::Random(5000, 16);
+    Matrix queries = Matrix::Random(300, 16);
+    CosineIndex index(corpus);
+
+    parallel::ThreadPool& pool = parallel::ThreadPool::GetInstance();
+    const std::size_t worker_count = pool.WorkerCount();
+    pool.SetWorkerCount(1);
+    CosineIndex::Neighbors serial = index.Search(queries, 10);
+    pool.SetWorkerCount(8);
+    CosineIndex::Neighbors split = index.Search(queries, 10);
+    pool.SetWorkerCount(worker_count);
+
+    EXPECT_TRUE(std::equal(std::begin(serial.indices), std::end(serial.indices), std::begin(split.indices)));
+    EXPECT_TRUE(std::equal(serial.scores.Data(), serial.scores.Data() + 3000, split.scores.Data()));
+}
+
+TEST(CosineIndexTest, TieAndZeroCase) {
+    // Rows 1 and 3 point the same way as the query, row 2 is zero, row 4 is opposite.
+    Matrix corpus{{0.0, 1.0}, {2.0, 0.0}, {0.0, 0.0}, {0.5, 0.0}, {-1.0, 0.0}};
+    CosineIndex index(std::move(corpus));
+
+    CosineIndex::Neighbors neighbors = index.Search(Matrix({{3.0, 0.0}, {0.0, 0.0}}), 5);
+    EXPECT_EQ(Matrix({{1.0, 1.0, 0.0, 0.0, -1.0}, {0.0, 0.0, 0.0, 0.0, 0.0}}), neighbors.scores);
+    EXPECT_EQ((std::vector<std::size_t>{1, 3, 0, 2, 4, 0, 1, 2, 3, 4}),
+              std::vector<std::size_t>(std::begin(neighbors.indices), std::end(neighbors.indices)));
+
+    EXPECT_EQ(0U, index.Search(Matrix(0, 2), 1).scores.Row());
+    EXPECT_THROW(index.Search(Matrix(1, 3), 1), std::invalid_argument);
+    EXPECT_THROW(index.Search(Matrix(1, 2), 0), std::invalid_argument);
+    EXPECT_THROW(index.Search(Matrix(1, 2), 6), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace math_cpp
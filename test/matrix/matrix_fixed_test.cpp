@@ -0,0 +1,87 @@
+/// @file matrix_fixed_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_fixed.h"
+
+#include <gtest/gtest.h>
+
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::FixedMatrix;
+using matrix::Matrix;
+
+namespace {
+constexpr matrix::Matrix3d kRotation{{0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}};
+
+// Evaluated by the compiler
+static_assert(matrix::Matrix3d::Determinant(kRotation) == 1.0, "rotation determinant");
+static_assert((kRotation * kRotation.Transpose())(0, 0) == 1.0, "rotation is orthogonal");
+static_assert(kRotation.Inverse()(0, 1) == 1.0, "inverse of a rotation is its transpose");
+static_assert(FixedMatrix<2, 3>::Row() == 2 && FixedMatrix<2, 3>::Col() == 3, "shape");
+}  // namespace
+
+TEST(FixedMatrixTest, ArithmeticCase) {
+    FixedMatrix<2, 3> A{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    FixedMatrix<3, 2> B{{1.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}};
+
+    FixedMatrix<2, 2> C = A * B;
+    EXPECT_EQ(matrix::Matrix2d({{4.0, 5.0}, {10.0, 11.0}}), C);
+
+    FixedMatrix<3, 2> At = A.Transpose();
+    EXPECT_EQ((FixedMatrix<3, 2>{{1.0, 4.0}, {2.0, 5.0}, {3.0, 6.0}}), At);
+
+    FixedMatrix<2, 3> D = 2.0 * A - A / 2.0 + A * 0.5;
+    EXPECT_EQ((FixedMatrix<2, 3>{{2.0, 4.0, 6.0}, {8.0, 10.0, 12.0}}), D);
+
+    EXPECT_THROW((FixedMatrix<2, 2>{{1.0, 2.0}}), std::invalid_argument);
+}
+
+TEST(FixedMatrixTest, InverseDeterminantCase) {
+    Matrix random = Matrix::Random(6, 6);
+    matrix::Matrix6d A(random);
+    Eigen::MatrixXd eA = MakeEigenMatrix(random);
+
+    Eigen::MatrixXd expect_inverse = eA.inverse();
+    EXPECT_TRUE(expect_inverse == A.Inverse().ToMatrix());
+    EXPECT_NEAR(eA.determinant(), matrix::Matrix6d::Determinant(A), 1e-9);
+
+    matrix::Matrix3d B(Matrix::Random(3, 3));
+    EXPECT_EQ(matrix::Matrix3d::Identity(), B * B.Inverse());
+    EXPECT_NEAR(Matrix::Determinant(B.ToMatrix()), matrix::Matrix3d::Determinant(B), 1e-12);
+
+    matrix::Matrix2d singular{{1.0, 2.0}, {2.0, 4.0}};
+    EXPECT_THROW(singular.Inverse(), std::invalid_argument);
+    EXPECT_THROW(matrix::Matrix4d().Inverse(), std::invalid_argument);
+    EXPECT_EQ(0.0, matrix::Matrix4d::Determinant(matrix::Matrix4d()));
+}
+
+TEST(FixedMatrixTest, InteroperateCase) {
+    Matrix dynamic{{1.0, 2.0}, {3.0, 4.0}};
+    matrix::Matrix2d fixed(dynamic);
+
+    EXPECT_EQ(dynamic, fixed.ToMatrix());
+    EXPECT_THROW(matrix::Matrix3d{dynamic}, std::invalid_argument);
+
+    // Kernels run on views of the inline storage.
+    Matrix product(2, 2);
+    matrix::kernel::Gemm(1.0, fixed.View(), dynamic, 0.0, product);
+    Matrix expect = dynamic * dynamic;
+    EXPECT_EQ(expect, product);
+}
+
+}  // namespace test
+}  // namespace math_cpp
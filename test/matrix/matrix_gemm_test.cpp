@@ -0,0 +1,92 @@
+/// @file matrix_gemm_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_gemm.h"
+
+#include <gtest/gtest.h>
+
+#include <eigen3/Eigen/Dense>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+
+class MatrixGemmShapeTest : public ::testing::TestWithParam<std::tuple<std::size_t, std::size_t, std::size_t>> {};
+
+TEST_P(MatrixGemmShapeTest, MatchNaiveCase) {
+    std::size_t m = 0, n = 0, k = 0;
+    std::tie(m, n, k) = GetParam();
+
+    Matrix a = Matrix::Random(m, k);
+    Matrix b = Matrix::Random(k, n);
+    Matrix c = Matrix::Random(m, n);
+    Matrix expect = c;
+
+    matrix::kernel::Gemm(m, n, k, 1.5, a.Data(), k, b.Data(), n, -0.5, c.Data(), n);
+    matrix::kernel::GemmNaive(m, n, k, 1.5, a.Data(), k, b.Data(), n, -0.5, expect.Data(), n);
+
+    for (std::size_t r = 0; r < m; ++r) {
+        for (std::size_t col = 0; col < n; ++col) {
+            EXPECT_NEAR(expect(r, col), c(r, col), 1e-9) << "(" << r << ", " << col << ")";
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(MatrixGemmTest, MatrixGemmShapeTest,
+                         ::testing::Values(std::make_tuple(1, 1, 1), std::make_tuple(3, 5, 7),
+                                           std::make_tuple(33, 31, 35), std::make_tuple(130, 9, 260),
+                                           std::make_tuple(5, 133, 257), std::make_tuple(129, 137, 300)));
+
+TEST(MatrixGemmTest, BetaZeroIgnoresOutputCase) {
+    Matrix a = Matrix::Random(40, 40);
+    Matrix b = Matrix::Random(40, 40);
+    Matrix c(40, 40, std::numeric_limits<double>::quiet_NaN());
+
+    matrix::kernel::Gemm(40, 40, 40, 1.0, a.Data(), 40, b.Data(), 40, 0.0, c.Data(), 40);
+
+    Eigen::MatrixXd expect = MakeEigenMatrix(a) * MakeEigenMatrix(b);
+    EXPECT_TRUE(expect == c);
+}
+
+TEST(MatrixGemmTest, LeadingDimensionCase) {
+    Matrix a = Matrix::Random(64, 80);
+    Matrix b = Matrix::Random(80, 72);
+    Matrix c(64, 72);
+
+    // Multiply the 50 x 60 top-left block of a with the 60 x 70 top-left block of b.
+    matrix::kernel::Gemm(50, 70, 60, 1.0, a.Data(), 80, b.Data(), 72, 0.0, c.Data(), 72);
+
+    Eigen::MatrixXd expect = MakeEigenMatrix(a).topLeftCorner(50, 60) * MakeEigenMatrix(b).topLeftCorner(60, 70);
+    for (std::size_t r = 0; r < 50; ++r) {
+        for (std::size_t col = 0; col < 70; ++col) {
+            EXPECT_NEAR(expect(r, col), c(r, col), 1e-9);
+        }
+    }
+    EXPECT_EQ(0.0, c(50, 0));
+    EXPECT_EQ(0.0, c(0, 70));
+}
+
+TEST(MatrixGemmTest, OperatorMatchEigenCase) {
+    Matrix a = Matrix::Random(200, 300);
+    Matrix b = Matrix::Random(300, 150);
+
+    Eigen::MatrixXd expect = MakeEigenMatrix(a) * MakeEigenMatrix(b);
+    EXPECT_TRUE(expect == a * b);
+}
+
+}  // namespace test
+}  // namespace math_cpp
@@ -0,0 +1,157 @@
+/// @file matrix_krylov_solver_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_krylov_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::KrylovSolver;
+using matrix::Matrix;
+using matrix::SparseMatrix;
+
+namespace {
+/// 5-point Laplacian of a grid x grid mesh, plus `convection` on the east neighbour to make it non-symmetric.
+SparseMatrix MakeLaplacian(std::size_t grid, double convection = 0.0) {
+    SparseMatrix::Builder builder(grid * grid, grid * grid);
+    for (std::size_t r = 0; r < grid; ++r) {
+        for (std::size_t c = 0; c < grid; ++c) {
+            const std::size_t i = r * grid + c;
+            builder.Add(i, i, 4.0);
+            if (r > 0) {
+                builder.Add(i, i - grid, -1.0);
+            }
+            if (r + 1 < grid) {
+                builder.Add(i, i + grid, -1.0);
+            }
+            if (c > 0) {
+                builder.Add(i, i - 1, -1.0);
+            }
+            if (c + 1 < grid) {
+                builder.Add(i, i + 1, -1.0 + convection);
+            }
+        }
+    }
+    return builder.Build();
+}
+
+double TrueResidual(const SparseMatrix& A, const Matrix& x, const Matrix& b) {
+    return Matrix::Norm2(A * x - b) / Matrix::Norm2(b);
+}
+}  // namespace
+
+TEST(KrylovSolverTest, ConjugateGradientCase) {
+    SparseMatrix A = MakeLaplacian(20);
+    Matrix b = Matrix::Random(A.Row(), 1);
+
+    KrylovSolver plain(KrylovSolver::Method::kCG, A);
+    Matrix x = plain.Solve(b);
+    EXPECT_TRUE(plain.IsConverged());
+    EXPECT_LT(TrueResidual(A, x, b), 1e-9);
+    EXPECT_EQ(plain.Iterations() + 1, plain.ResidualHistory().size());
+    EXPECT_EQ(plain.RelativeResidual(), plain.ResidualHistory().back());
+
+    KrylovSolver jacobi(KrylovSolver::Method::kCG, A, matrix::MakeJacobiPreconditioner(A));
+    x = jacobi.Solve(b);
+    EXPECT_TRUE(jacobi.IsConverged());
+    EXPECT_LT(TrueResidual(A, x, b), 1e-9);
+
+    KrylovSolver cholesky(KrylovSolver::Method::kCG, A, matrix::MakeIncompleteCholeskyPreconditioner(A));
+    x = cholesky.Solve(b);
+    EXPECT_TRUE(cholesky.IsConverged());
+    EXPECT_LT(TrueResidual(A, x, b), 1e-9);
+    EXPECT_LT(cholesky.Iterations(), plain.Iterations());
+}
+
+TEST(KrylovSolverTest, NonSymmetricCase) {
+    SparseMatrix A = MakeLaplacian(20, 0.5);
+    Matrix b = Matrix::Random(A.Row(), 1);
+
+    for (auto method : {KrylovSolver::Method::kBiCGSTAB, KrylovSolver::Method::kGMRES}) {
+        KrylovSolver plain(method, A);
+        Matrix x = plain.Solve(b);
+        EXPECT_TRUE(plain.IsConverged());
+        EXPECT_LT(TrueResidual(A, x, b), 1e-9);
+
+        KrylovSolver jacobi(method, A, matrix::MakeJacobiPreconditioner(A));
+        x = jacobi.Solve(b);
+        EXPECT_TRUE(jacobi.IsConverged());
+        EXPECT_LT(TrueResidual(A, x, b), 1e-9);
+    }
+
+    // A short restart still converges, only slower.
+    KrylovSolver gmres(KrylovSolver::Method::kGMRES, A);
+    gmres.SetRestart(5);
+    Matrix x = gmres.Solve(b);
+    EXPECT_TRUE(gmres.IsConverged());
+    EXPECT_LT(TrueResidual(A, x, b), 1e-9);
+    EXPECT_EQ(gmres.Iterations() + 1, gmres.ResidualHistory().size());
+    EXPECT_THROW(gmres.SetRestart(0), std::invalid_argument);
+}
+
+TEST(KrylovSolverTest, DenseCase) {
+    Matrix A = MakeSymmetricPositiveDefinite(60);
+    Matrix b = Matrix::Random(60, 1);
+    Eigen::MatrixXd expect = MakeEigenMatrix(A).ldlt().solve(MakeEigenMatrix(b));
+
+    for (auto method : {KrylovSolver::Method::kCG, KrylovSolver::Method::kBiCGSTAB, KrylovSolver::Method::kGMRES}) {
+        KrylovSolver solver(method, A, matrix::MakeIncompleteCholeskyPreconditioner(A));
+        EXPECT_TRUE(expect == solver.Solve(b));
+        EXPECT_TRUE(solver.IsConverged());
+    }
+
+    // Any callable works as the operator, here A * x through a lambda.
+    matrix::LinearOperator op = [&A](const matrix::ConstMatrixView& x, const matrix::MatrixView& y) {
+        matrix::kernel::Gemm(1.0, A, x, 0.0, y);
+    };
+    KrylovSolver solver(KrylovSolver::Method::kCG, op, 60);
+    EXPECT_TRUE(expect == solver.Solve(b));
+    EXPECT_EQ(solver.Iterations() + 1, solver.OperatorCalls());
+}
+
+TEST(KrylovSolverTest, StatisticsCase) {
+    SparseMatrix A = MakeLaplacian(10);
+    Matrix b = Matrix::Random(A.Row(), 1);
+
+    KrylovSolver limited(KrylovSolver::Method::kCG, A, {}, 1e-10, 3);
+    Matrix x = limited.Solve(b);
+    EXPECT_FALSE(limited.IsConverged());
+    EXPECT_EQ(3U, limited.Iterations());
+    EXPECT_EQ(4U, limited.ResidualHistory().size());
+    EXPECT_DOUBLE_EQ(1.0, limited.ResidualHistory().front());
+
+    // Restarting from the last x continues where the first solve stopped.
+    KrylovSolver solver(KrylovSolver::Method::kCG, A);
+    solver.Solve(b, x);
+    EXPECT_TRUE(solver.IsConverged());
+    EXPECT_NEAR(limited.RelativeResidual(), solver.ResidualHistory().front(), 1e-9);
+
+    Matrix zero = solver.Solve(Matrix(A.Row(), 1));
+    EXPECT_TRUE(solver.IsConverged());
+    EXPECT_EQ(0U, solver.Iterations());
+    EXPECT_EQ(0.0, Matrix::Norm2(zero));
+
+    EXPECT_THROW(solver.Solve(Matrix(3, 1)), std::invalid_argument);
+    EXPECT_THROW(KrylovSolver(KrylovSolver::Method::kCG, Matrix(3, 4)), std::invalid_argument);
+    EXPECT_THROW(matrix::MakeJacobiPreconditioner(Matrix(3, 3)), std::invalid_argument);
+    EXPECT_THROW(matrix::MakeIncompleteCholeskyPreconditioner(Matrix({{1.0, 2.0}, {2.0, 1.0}})),
+                 std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace math_cpp
@@ -0,0 +1,102 @@
+/// @file matrix_lanczos_solver_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_lanczos_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::LanczosSolver;
+using matrix::Matrix;
+
+namespace {
+/// A * v = value * v for every column of the solver result.
+void ExpectEigenPairs(const Matrix& A, const LanczosSolver& solver) {
+    Matrix values = solver.Eigenvalues();
+    Matrix vectors = solver.Eigenvectors();
+    Matrix AV = A * vectors;
+    for (std::size_t i = 0; i < values.Row(); ++i) {
+        Matrix scaled = vectors.GetCol(i) * values(i, 0);
+        EXPECT_EQ(scaled, AV.GetCol(i));
+        EXPECT_NEAR(1.0, Matrix::Norm2(vectors.GetCol(i)), 1e-9);
+    }
+}
+}  // namespace
+
+TEST(LanczosSolverTest, LargestMagnitudeCase) {
+    Matrix A = MakeSymmetric(300);
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> expect(MakeEigenMatrix(A), Eigen::EigenvaluesOnly);
+    Eigen::VectorXd expect_values = expect.eigenvalues();
+    std::sort(expect_values.data(), expect_values.data() + expect_values.size(),
+              [](double lhs, double rhs) { return std::abs(lhs) > std::abs(rhs); });
+
+    LanczosSolver solver(A, 10);
+
+    EXPECT_TRUE(solver.IsConverged());
+    Eigen::MatrixXd top = expect_values.head(10);
+    EXPECT_TRUE(top == solver.Eigenvalues());
+    ExpectEigenPairs(A, solver);
+}
+
+TEST(LanczosSolverTest, AlgebraicCase) {
+    Matrix A = MakeSymmetric(200);
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> expect(MakeEigenMatrix(A), Eigen::EigenvaluesOnly);
+    Eigen::VectorXd expect_values = expect.eigenvalues();
+
+    LanczosSolver smallest(A, 5, LanczosSolver::Which::kSmallestAlgebraic);
+    Eigen::MatrixXd head = expect_values.head(5);
+    EXPECT_TRUE(head == smallest.Eigenvalues());
+    ExpectEigenPairs(A, smallest);
+
+    LanczosSolver largest(A, 5, LanczosSolver::Which::kLargestAlgebraic);
+    Eigen::MatrixXd tail = expect_values.tail(5).reverse();
+    EXPECT_TRUE(tail == largest.Eigenvalues());
+}
+
+TEST(LanczosSolverTest, ImplicitOperatorCase) {
+    // 1D Laplacian, eigenvalues 2 - 2 cos(pi * j / (n + 1)), never stored as a matrix.
+    const std::size_t n = 500;
+    matrix::LinearOperator laplacian = [n](const matrix::ConstMatrixView& x, const matrix::MatrixView& y) {
+        for (std::size_t i = 0; i < n; ++i) {
+            y(i, 0) = 2.0 * x(i, 0) - ((i > 0) ? x(i - 1, 0) : 0.0) - ((i + 1 < n) ? x(i + 1, 0) : 0.0);
+        }
+    };
+
+    LanczosSolver solver(laplacian, n, 3, LanczosSolver::Which::kLargestAlgebraic, 1e-10, 1000);
+
+    EXPECT_TRUE(solver.IsConverged());
+    const double pi = std::acos(-1.0);
+    for (std::size_t j = 0; j < 3; ++j) {
+        EXPECT_NEAR(2.0 - 2.0 * std::cos(pi * static_cast<double>(n - j) / (n + 1)), solver.Eigenvalues()(j, 0), 1e-8);
+    }
+}
+
+TEST(LanczosSolverTest, SmallAndInvalidCase) {
+    Matrix A{{2.0, 0.0, 0.0}, {0.0, -5.0, 0.0}, {0.0, 0.0, 1.0}};
+
+    LanczosSolver solver(A, 3);
+    EXPECT_EQ(Matrix({{-5.0}, {2.0}, {1.0}}), solver.Eigenvalues());
+    ExpectEigenPairs(A, solver);
+
+    EXPECT_THROW(LanczosSolver(A, 0), std::invalid_argument);
+    EXPECT_THROW(LanczosSolver(A, 4), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace math_cpp
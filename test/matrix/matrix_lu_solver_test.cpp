@@ -0,0 +1,100 @@
+/// @file matrix_lu_solver_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_lu_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+#include <utility>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::LUSolver;
+using matrix::Matrix;
+
+TEST(LUSolverTest, ZeroPivotCase) {
+    // Unpivoted elimination divides by A(0, 0) = 0 here.
+    Matrix A{{0.0, 2.0, 1.0}, {1.0, 1.0, 0.0}, {3.0, 0.0, 1.0}};
+    LUSolver solver(A);
+
+    EXPECT_FALSE(solver.IsSingular());
+    EXPECT_EQ(Matrix::Identity(3), A * solver.Inverse());
+    EXPECT_EQ(Matrix::Identity(3), A * A.Inverse());
+    EXPECT_NEAR(-5.0, solver.Determinant(), 1e-12);
+}
+
+TEST(LUSolverTest, FactorsCase) {
+    Matrix A = Matrix::Random(150, 150);
+    LUSolver solver(A);
+
+    // P * A = L * U
+    Matrix PA = A;
+    for (std::size_t i = 0; i < A.Row(); ++i) {
+        const std::size_t p = solver.Pivots()[i];
+        for (std::size_t c = 0; c < A.Col(); ++c) {
+            std::swap(PA(i, c), PA(p, c));
+        }
+    }
+    Matrix LU = solver.Lower() * solver.Upper();
+    EXPECT_EQ(PA, LU);
+
+    Eigen::MatrixXd eA = MakeEigenMatrix(A);
+    EXPECT_NEAR(eA.determinant(), solver.Determinant(), 1e-6 * std::abs(eA.determinant()));
+}
+
+TEST(LUSolverTest, SolveManyCase) {
+    Matrix A = Matrix::Random(130, 130);
+    Matrix B = Matrix::Random(130, 70);
+    Eigen::MatrixXd eA = MakeEigenMatrix(A), eB = MakeEigenMatrix(B);
+
+    LUSolver solver(A);
+    Eigen::MatrixXd expect = eA.partialPivLu().solve(eB);
+    EXPECT_TRUE(expect == solver.Solve(B));
+
+    Matrix b = B.GetCol(3);
+    Eigen::MatrixXd expect_b = eA.partialPivLu().solve(eB.col(3));
+    EXPECT_TRUE(expect_b == solver.Solve(b));
+
+    // In place on a strided view
+    solver.SolveInPlace(B.ColView(5));
+    Eigen::MatrixXd expect_col = eA.partialPivLu().solve(eB.col(5));
+    EXPECT_TRUE(expect_col == B.GetCol(5));
+}
+
+TEST(LUSolverTest, DivisionCase) {
+    Matrix A = Matrix::Random(20, 20);
+    Matrix B = Matrix::Random(5, 20);
+    Eigen::MatrixXd eA = MakeEigenMatrix(A), eB = MakeEigenMatrix(B);
+
+    Eigen::MatrixXd expect = eB * eA.inverse();
+    EXPECT_TRUE(expect == B / A);
+    Eigen::MatrixXd expect_scalar = 2.0 * eA.inverse();
+    EXPECT_TRUE(expect_scalar == 2.0 / A);
+}
+
+TEST(LUSolverTest, SingularCase) {
+    Matrix A{{1.0, 2.0}, {2.0, 4.0}};
+    LUSolver solver(A);
+
+    EXPECT_TRUE(solver.IsSingular());
+    EXPECT_EQ(0.0, solver.Determinant());
+    EXPECT_THROW(solver.Inverse(), std::invalid_argument);
+    EXPECT_THROW(LUSolver(Matrix(2, 3)), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace math_cpp
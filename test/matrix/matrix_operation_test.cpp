@@ -0,0 +1,123 @@
+/// @file matrix_operation_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_operation.h"
+
+#include <gtest/gtest.h>
+
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+
+TEST(MatrixOperationTest, FusedElementwiseCase) {
+    Matrix A{{1.0, 2.0}, {3.0, 4.0}};
+    Matrix B{{7.0, -2.0}, {5.0, 8.0}};
+
+    Matrix result = 3.0 * A - B / 2.0 + 1.0 - (2.0 - A);
+
+    EXPECT_EQ(Matrix({{-0.5, 8.0}, {8.5, 11.0}}), result);
+}
+
+TEST(MatrixOperationTest, ProductChainCase) {
+    Matrix A = Matrix::Random(40, 30);
+    Matrix B = Matrix::Random(30, 50);
+    Matrix C = Matrix::Random(50, 1);
+    Eigen::MatrixXd eA = MakeEigenMatrix(A), eB = MakeEigenMatrix(B), eC = MakeEigenMatrix(C);
+
+    Eigen::MatrixXd expect = 2.0 * eA * eB * eC;
+    Matrix result = 2.0 * A * B * C;
+
+    EXPECT_TRUE(expect == result);
+}
+
+TEST(MatrixOperationTest, ProductInsideElementwiseCase) {
+    Matrix A = Matrix::Random(8, 8);
+    Matrix v = Matrix::Random(8, 1);
+    Eigen::MatrixXd eA = MakeEigenMatrix(A), ev = MakeEigenMatrix(v);
+
+    Eigen::MatrixXd expect = eA * eA * ev - 0.5 * ev;
+    Matrix result = A * A * v - 0.5 * v;
+
+    EXPECT_TRUE(expect == result);
+}
+
+TEST(MatrixOperationTest, CompoundAssignAliasCase) {
+    Matrix A = Matrix::Random(6, 6);
+    Matrix B = Matrix::Random(6, 6);
+    Eigen::MatrixXd eA = MakeEigenMatrix(A), eB = MakeEigenMatrix(B);
+
+    A += A * B;
+    eA += eA * eB;
+    EXPECT_TRUE(eA == A);
+
+    A -= 2.0 * A + B;
+    eA -= 2.0 * eA + eB;
+    EXPECT_TRUE(eA == A);
+}
+
+TEST(MatrixOperationTest, ScalarCastCase) {
+    Matrix a{{1.0, 2.0, 3.0}};
+
+    EXPECT_EQ(14.0, static_cast<double>(a * a.Transpose()));
+}
+
+TEST(MatrixOperationTest, MatrixInterfaceCase) {
+    // Code written when the operators returned Matrix keeps compiling and gives the same results.
+    Matrix A{{1.0, 2.0}, {3.0, 4.0}};
+    Matrix B{{7.0, -2.0}, {5.0, 8.0}};
+    Matrix product = A;
+    product = A * B;
+    Matrix difference = A;
+    difference = A - B;
+
+    EXPECT_EQ(product.Transpose(), (A * B).Transpose());
+    EXPECT_EQ(product(1, 0), (A * B)(1, 0));
+    EXPECT_EQ(2U, (A + B).Row());
+    EXPECT_EQ(product.GetRow(1), (A * B).GetRow(1));
+    EXPECT_EQ(product.GetCol(0), (A * B).GetCol(0));
+    EXPECT_EQ(product.Inverse(), (A * B).Inverse());
+    EXPECT_EQ(Matrix(difference).Absolute(), (A - B).Absolute());
+    EXPECT_TRUE((A * B) == product);
+    EXPECT_FALSE((A * B) != product);
+    EXPECT_TRUE((A + B).IsSameSize(A));
+    EXPECT_TRUE((A * B).CanMultiply(B));
+}
+
+TEST(MatrixOperationTest, TemporaryOperandCase) {
+    Matrix A = Matrix::Random(5, 4);
+    Matrix B = Matrix::Random(5, 3);
+    Matrix expect = A.Transpose();
+    expect = expect * B;
+
+    // A.Transpose() is a temporary that ends with the full expression, the expression keeps its own copy.
+    auto product = A.Transpose() * B;
+    auto shifted = Matrix(B) - 1.0;
+    Matrix result = product;
+    EXPECT_EQ(expect, result);
+    EXPECT_EQ(B - 1.0, Matrix(shifted));
+}
+
+TEST(MatrixOperationTest, ShapeMismatchCase) {
+    Matrix A(2, 3);
+    Matrix B(3, 2);
+
+    EXPECT_THROW(Matrix result = A + B, std::invalid_argument);
+    EXPECT_THROW(Matrix result = A * A, std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace math_cpp
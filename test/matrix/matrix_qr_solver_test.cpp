@@ -0,0 +1,125 @@
+/// @file matrix_qr_solver_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_qr_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+using matrix::QRSolver;
+
+namespace {
+bool IsUpperTrapezoidal(const Matrix& mat) {
+    for (std::size_t r = 1; r < mat.Row(); ++r) {
+        for (std::size_t c = 0; c < std::min(r, mat.Col()); ++c) {
+            if (mat(r, c) != 0.0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/// Columns of mat in the order of the solver permutation.
+Matrix PermuteColumns(const Matrix& mat, const QRSolver& solver) {
+    Matrix result(mat.Row(), mat.Col());
+    for (std::size_t j = 0; j < mat.Col(); ++j) {
+        matrix::kernel::Copy(mat.ColView(solver.Permutation()[j]), result.ColView(j));
+    }
+    return result;
+}
+}  // namespace
+
+TEST(QRSolverTest, FactorsCase) {
+    // 70 columns span three panels, so the compact WY updates are covered.
+    Matrix A = Matrix::Random(200, 70);
+    QRSolver solver(A);
+
+    Matrix Q = solver.Q();
+    Matrix R = solver.R();
+    EXPECT_EQ(200U, Q.Row());
+    EXPECT_EQ(70U, Q.Col());
+    EXPECT_TRUE(IsUpperTrapezoidal(R));
+    EXPECT_EQ(Matrix::Identity(70), Q.Transpose() * Q);
+    EXPECT_EQ(A, Q * R);
+
+    // Q * Q^T * b == b with the full Q.
+    Matrix b = Matrix::Random(200, 2);
+    Matrix round_trip = b;
+    solver.ApplyQTranspose(round_trip);
+    solver.ApplyQ(round_trip);
+    EXPECT_EQ(b, round_trip);
+}
+
+TEST(QRSolverTest, LeastSquaresCase) {
+    Matrix A = Matrix::Random(300, 40);
+    Matrix b = Matrix::Random(300, 3);
+    Eigen::MatrixXd expect = MakeEigenMatrix(A).householderQr().solve(MakeEigenMatrix(b));
+
+    EXPECT_TRUE(expect == QRSolver(A).SolveLeastSquares(b));
+    EXPECT_TRUE(expect == QRSolver(A, QRSolver::Pivoting::kColumn).SolveLeastSquares(b));
+
+    // A square non-singular system is solved exactly.
+    Matrix S = Matrix::Random(50, 50);
+    Matrix x = Matrix::Random(50, 1);
+    Matrix Sx = S * x;
+    EXPECT_EQ(x, QRSolver(S).SolveLeastSquares(Sx));
+
+    EXPECT_THROW(QRSolver(Matrix::Random(3, 5)).SolveLeastSquares(Matrix(3, 1)), std::invalid_argument);
+    EXPECT_THROW(QRSolver(A).SolveLeastSquares(Matrix(10, 1)), std::invalid_argument);
+}
+
+TEST(QRSolverTest, PivotedCase) {
+    // Rank 25 by construction.
+    Matrix A = Matrix::Random(120, 25) * Matrix::Random(25, 40);
+    QRSolver solver(A, QRSolver::Pivoting::kColumn);
+
+    EXPECT_EQ(25U, solver.Rank());
+    Matrix R = solver.R();
+    EXPECT_TRUE(IsUpperTrapezoidal(R));
+    for (std::size_t i = 1; i < R.Row(); ++i) {
+        EXPECT_LE(std::abs(R(i, i)), std::abs(R(i - 1, i - 1)) * (1.0 + 1e-12));
+    }
+    EXPECT_EQ(PermuteColumns(A, solver), solver.Q() * R);
+
+    // The basic solution reaches the minimal residual of a rank deficient problem.
+    Matrix b = Matrix::Random(120, 1);
+    Matrix x = solver.SolveLeastSquares(b);
+    Eigen::MatrixXd eigen_a = MakeEigenMatrix(A);
+    Eigen::MatrixXd best = eigen_a.completeOrthogonalDecomposition().solve(MakeEigenMatrix(b));
+    Matrix residual = A * x - b;
+    EXPECT_NEAR((eigen_a * best - MakeEigenMatrix(b)).norm(), Matrix::Norm2(residual), 1e-8);
+    std::size_t zeros = 0;
+    for (std::size_t i = 0; i < x.Row(); ++i) {
+        zeros += (x(i, 0) == 0.0) ? 1 : 0;
+    }
+    EXPECT_EQ(15U, zeros);
+
+    EXPECT_THROW(QRSolver(A).SolveLeastSquares(b), std::invalid_argument);
+
+    // Wide matrices factor too.
+    Matrix wide = Matrix::Random(30, 80);
+    QRSolver wide_solver(wide, QRSolver::Pivoting::kColumn);
+    EXPECT_EQ(30U, wide_solver.Rank());
+    EXPECT_EQ(PermuteColumns(wide, wide_solver), wide_solver.Q() * wide_solver.R());
+}
+
+}  // namespace test
+}  // namespace math_cpp
@@ -0,0 +1,107 @@
+/// @file matrix_randomized_svd_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_randomized_svd.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "src/random/random.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+using matrix::RandomizedSVD;
+
+namespace {
+/// Orthonormal columns, singular values 0.7^i and orthonormal rows, so the spectrum decays but has no gap.
+Matrix MakeDecaying(std::size_t row, std::size_t col) {
+    Matrix u = matrix::QRSolver(Matrix::Random(row, col)).Q();
+    Matrix v = matrix::QRSolver(Matrix::Random(col, col)).Q();
+    for (std::size_t r = 0; r < row; ++r) {
+        for (std::size_t c = 0; c < col; ++c) {
+            u(r, c) *= std::pow(0.7, static_cast<double>(c));
+        }
+    }
+    Matrix result = u * v.Transpose();
+    return result;
+}
+
+void ExpectOrthonormalFactors(const RandomizedSVD& svd, std::size_t rank) {
+    Matrix U = svd.U();
+    Matrix Vt = svd.VTranspose();
+    EXPECT_EQ(Matrix::Identity(rank), U.Transpose() * U);
+    EXPECT_EQ(Matrix::Identity(rank), Vt * Vt.Transpose());
+    Matrix S = svd.SingularValues();
+    for (std::size_t i = 1; i < rank; ++i) {
+        EXPECT_GE(S(i - 1, 0), S(i, 0));
+    }
+}
+}  // namespace
+
+TEST(RandomizedSVDTest, ExactRankCase) {
+    // Rank 15 by construction, the sketch captures the whole range and the approximation is exact.
+    Matrix A = Matrix::Random(200, 15) * Matrix::Random(15, 120);
+    RandomizedSVD svd(A, 15);
+
+    Eigen::VectorXd expect = MakeEigenMatrix(A).jacobiSvd().singularValues();
+    Eigen::MatrixXd top = expect.head(15);
+    EXPECT_TRUE(top == svd.SingularValues());
+    EXPECT_EQ(A, svd.LowRankApproximation());
+    ExpectOrthonormalFactors(svd, 15);
+    EXPECT_EQ(200U, svd.U().Row());
+    EXPECT_EQ(120U, svd.VTranspose().Col());
+}
+
+TEST(RandomizedSVDTest, DecayingSpectrumCase) {
+    Matrix A = MakeDecaying(300, 80);
+    Eigen::JacobiSVD<Eigen::MatrixXd> expect(MakeEigenMatrix(A), Eigen::ComputeThinU | Eigen::ComputeThinV);
+
+    random::Random generator(2022);
+    RandomizedSVD svd(A, 10, generator);
+    ExpectOrthonormalFactors(svd, 10);
+    Matrix S = svd.SingularValues();
+    for (std::size_t i = 0; i < 10; ++i) {
+        EXPECT_NEAR(expect.singularValues()(static_cast<Eigen::Index>(i)), S(i, 0), 1e-8);
+    }
+
+    // The best rank 10 error in the 2-norm is the 11th singular value.
+    Eigen::MatrixXd error = MakeEigenMatrix(A) - MakeEigenMatrix(svd.LowRankApproximation());
+    EXPECT_NEAR(expect.singularValues()(10), error.jacobiSvd().singularValues()(0), 1e-8);
+
+    // Without power iterations the sketch is coarser, but the leading value is still close.
+    RandomizedSVD rough(A, 10, generator, 5, 0);
+    EXPECT_NEAR(expect.singularValues()(0), rough.SingularValues()(0, 0), 1e-2);
+
+    // The same generator state gives the same factors.
+    random::Random lhs(7);
+    random::Random rhs(7);
+    EXPECT_EQ(RandomizedSVD(A, 5, lhs).U().Data()[3], RandomizedSVD(A, 5, rhs).U().Data()[3]);
+}
+
+TEST(RandomizedSVDTest, WideCase) {
+    Matrix A = MakeDecaying(60, 60).Transpose();
+    Matrix wide(60, 200);
+    matrix::kernel::Copy(A, wide.View().Block(0, 0, 60, 60));
+    RandomizedSVD svd(wide, 60);
+    EXPECT_EQ(wide, svd.LowRankApproximation());
+
+    EXPECT_THROW(RandomizedSVD(wide, 0), std::invalid_argument);
+    EXPECT_THROW(RandomizedSVD(wide, 61), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace math_cpp
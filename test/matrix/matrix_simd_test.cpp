@@ -0,0 +1,137 @@
+/// @file matrix_simd_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_simd.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "src/matrix/matrix.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+using matrix::simd::Isa;
+
+class MatrixSimdTest : public ::testing::TestWithParam<Isa> {
+ protected:
+    void SetUp() override {
+        previous_ = matrix::simd::ActiveIsa();
+        if (!matrix::simd::SetIsa(GetParam())) {
+            GTEST_SKIP() << matrix::simd::IsaName(GetParam()) << " is not supported on this CPU";
+        }
+    }
+    void TearDown() override { matrix::simd::SetIsa(previous_); }
+
+    static std::vector<double> Values(std::size_t n, double offset) {
+        std::vector<double> values(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            values[i] = std::sin(static_cast<double>(i) + offset) * 10.0;
+        }
+        return values;
+    }
+
+ private:
+    Isa previous_{Isa::kScalar};
+};
+
+TEST_P(MatrixSimdTest, ElementwiseCase) {
+    for (std::size_t n : {0, 1, 3, 8, 17, 33, 1001}) {
+        std::vector<double> a = Values(n, 0.0);
+        std::vector<double> b = Values(n, 1.5);
+        std::vector<double> out(n);
+
+        matrix::simd::Add(a.data(), b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) EXPECT_DOUBLE_EQ(a[i] + b[i], out[i]);
+
+        matrix::simd::Sub(a.data(), b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) EXPECT_DOUBLE_EQ(a[i] - b[i], out[i]);
+
+        matrix::simd::Scale(-2.5, a.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) EXPECT_DOUBLE_EQ(-2.5 * a[i], out[i]);
+
+        matrix::simd::Abs(a.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) EXPECT_DOUBLE_EQ(std::abs(a[i]), out[i]);
+
+        out = b;
+        matrix::simd::Axpy(0.5, a.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) EXPECT_NEAR(b[i] + 0.5 * a[i], out[i], 1e-12);
+    }
+}
+
+TEST_P(MatrixSimdTest, ReductionCase) {
+    for (std::size_t n : {0, 1, 3, 8, 17, 33, 1001}) {
+        std::vector<double> a = Values(n, 0.0);
+        std::vector<double> b = Values(n, 1.5);
+
+        double dot = 0.0, sum_squares = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            dot += a[i] * b[i];
+            sum_squares += a[i] * a[i];
+        }
+
+        EXPECT_NEAR(dot, matrix::simd::Dot(a.data(), b.data(), n), 1e-9);
+        EXPECT_NEAR(sum_squares, matrix::simd::SumSquares(a.data(), n), 1e-9);
+    }
+}
+
+TEST_P(MatrixSimdTest, TransposeCase) {
+    // 4 x 4 blocks inside a 5 x 6 source and a 7 x 9 destination
+    std::vector<double> src = Values(30, 0.0);
+    std::vector<double> dst(63, 0.0);
+    matrix::simd::Transpose4x4(src.data() + 6 + 1, 6, dst.data() + 9 + 2, 9);
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(src[(i + 1) * 6 + j + 1], dst[(j + 1) * 9 + i + 2]);
+        }
+    }
+    EXPECT_EQ(0.0, dst[0]);
+
+    // Non-square shapes cover the blocked tiles, the 4 x 4 blocks and the edges.
+    for (std::size_t n : {5, 37, 70}) {
+        Matrix a = Matrix::Random(n, n + 3);
+        Matrix t = a.Transpose();
+        Matrix square = Matrix::Random(n, n);
+        Matrix expect = square.Transpose();
+        square.TransposeInPlace();
+        for (std::size_t r = 0; r < n; ++r) {
+            for (std::size_t c = 0; c < n + 3; ++c) {
+                EXPECT_EQ(a(r, c), t(c, r));
+            }
+            for (std::size_t c = 0; c < n; ++c) {
+                EXPECT_EQ(expect(r, c), square(r, c));
+            }
+        }
+    }
+}
+
+TEST_P(MatrixSimdTest, MatrixRoutingCase) {
+    Matrix a{{1.0, -2.0, 3.0}, {-4.0, 5.0, -6.0}};
+    Matrix b{{1.0, 1.0, 1.0}, {2.0, 2.0, 2.0}};
+
+    EXPECT_EQ(Matrix({{2.0, -1.0, 4.0}, {-2.0, 7.0, -4.0}}), a + b);
+    EXPECT_EQ(Matrix({{0.0, -3.0, 2.0}, {-6.0, 3.0, -8.0}}), a - b);
+    EXPECT_EQ(Matrix({{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}}), Matrix(a).Absolute());
+    EXPECT_NEAR(std::sqrt(91.0), Matrix::Norm2(a), 1e-12);
+}
+
+INSTANTIATE_TEST_SUITE_P(MatrixSimdTest, MatrixSimdTest,
+                         ::testing::Values(Isa::kScalar, Isa::kSSE2, Isa::kAVX2, Isa::kAVX512),
+                         [](const ::testing::TestParamInfo<Isa>& info) {
+                             return std::string(matrix::simd::IsaName(info.param)) == "AVX-512"
+                                        ? std::string("AVX512")
+                                        : std::string(matrix::simd::IsaName(info.param));
+                         });
+
+}  // namespace test
+}  // namespace math_cpp
@@ -0,0 +1,121 @@
+/// @file matrix_sparse_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_sparse.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+using matrix::SparseMatrix;
+
+namespace {
+/// Dense n x n matrix with at most three non-zeros per row and column.
+Matrix MakeSparseDense(std::size_t n) {
+    Matrix dense(n, n);
+    for (std::size_t r = 0; r < n; ++r) {
+        dense(r, r) = 4.0 + static_cast<double>(r % 3);
+        dense(r, (r * 7 + 3) % n) += 1.0;
+        dense((r * 5 + 1) % n, r) -= 0.5;
+    }
+    return dense;
+}
+}  // namespace
+
+TEST(SparseMatrixTest, BuilderCase) {
+    SparseMatrix::Builder builder(3, 4);
+    builder.Add(2, 1, 1.0).Add(0, 3, 2.0).Add(2, 1, 0.5).Add(1, 0, -1.0);
+    EXPECT_THROW(builder.Add(3, 0, 1.0), std::invalid_argument);
+
+    for (auto format : {SparseMatrix::Format::kCSR, SparseMatrix::Format::kCSC}) {
+        SparseMatrix A = builder.Build(format);
+        EXPECT_EQ(3U, A.NonZeros());
+        EXPECT_EQ(format, A.GetFormat());
+        EXPECT_EQ(1.5, A.At(2, 1));
+        EXPECT_EQ(0.0, A.At(1, 1));
+        EXPECT_EQ(Matrix({{0.0, 0.0, 0.0, 2.0}, {-1.0, 0.0, 0.0, 0.0}, {0.0, 1.5, 0.0, 0.0}}), A.ToDense());
+    }
+
+    SparseMatrix csr = builder.Build();
+    EXPECT_EQ(4U, csr.Offsets().size());
+    EXPECT_EQ(3U, csr.Offsets().back());
+}
+
+TEST(SparseMatrixTest, ConversionCase) {
+    Matrix dense = MakeSparseDense(50);
+    SparseMatrix csr(dense);
+    SparseMatrix csc = csr.ToFormat(SparseMatrix::Format::kCSC);
+
+    EXPECT_EQ(SparseMatrix(dense, SparseMatrix::Format::kCSC).Indices(), csc.Indices());
+    EXPECT_EQ(dense, csc.ToDense());
+    EXPECT_EQ(dense, csc.ToFormat(SparseMatrix::Format::kCSR).ToDense());
+
+    Matrix rect = Matrix::Random(7, 3);
+    SparseMatrix transposed = SparseMatrix(rect).Transpose();
+    EXPECT_EQ(3U, transposed.Row());
+    EXPECT_EQ(SparseMatrix::Format::kCSR, transposed.GetFormat());
+    EXPECT_EQ(rect.Transpose(), transposed.ToDense());
+    EXPECT_EQ(rect.Transpose(), SparseMatrix(rect, SparseMatrix::Format::kCSC).Transpose().ToDense());
+}
+
+TEST(SparseMatrixTest, ProductCase) {
+    Matrix dense = MakeSparseDense(300);
+    Matrix x = Matrix::Random(300, 1);
+    Matrix B = Matrix::Random(300, 4);
+    Matrix C = Matrix::Random(300, 4);
+    Eigen::MatrixXd expect_y = MakeEigenMatrix(dense) * MakeEigenMatrix(x);
+    Eigen::MatrixXd expect_c = 2.0 * MakeEigenMatrix(dense) * MakeEigenMatrix(B) - MakeEigenMatrix(C);
+
+    for (auto format : {SparseMatrix::Format::kCSR, SparseMatrix::Format::kCSC}) {
+        SparseMatrix A(dense, format);
+        EXPECT_TRUE(expect_y == A * x);
+
+        Matrix result = C;
+        matrix::SpMM(2.0, A, B, -1.0, result);
+        EXPECT_TRUE(expect_c == result);
+
+        // Strided right hand side, a transposed view
+        Matrix Bt = B.Transpose();
+        result = C;
+        matrix::SpMM(2.0, A, Bt.View().Transpose(), -1.0, result);
+        EXPECT_TRUE(expect_c == result);
+
+        Matrix y(300, 1);
+        matrix::MakeLinearOperator(A)(x, y);
+        EXPECT_TRUE(expect_y == y);
+    }
+
+    EXPECT_THROW(SparseMatrix(dense) * Matrix(299, 1), std::invalid_argument);
+}
+
+TEST(SparseMatrixTest, LanczosCase) {
+    Matrix dense = MakeSparseDense(120);
+    Matrix symmetric = dense + dense.Transpose();
+    SparseMatrix A(symmetric);
+
+    matrix::LanczosSolver solver(matrix::MakeLinearOperator(A), A.Row(), 3);
+    matrix::LanczosSolver expect(symmetric, 3);
+    ASSERT_TRUE(solver.IsConverged());
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(expect.Eigenvalues()(i, 0), solver.Eigenvalues()(i, 0), 1e-8);
+    }
+}
+
+}  // namespace test
+}  // namespace math_cpp
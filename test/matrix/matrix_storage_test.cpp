@@ -0,0 +1,64 @@
+/// @file matrix_storage_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_storage.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "src/matrix/matrix.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+using matrix::Storage;
+
+TEST(StorageTest, InlineCase) {
+    Storage small(Storage::kInlineCapacity, 1.0);
+    EXPECT_TRUE(small.IsInline());
+
+    Storage large(Storage::kInlineCapacity + 1, 2.0);
+    EXPECT_FALSE(large.IsInline());
+    EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(large.Data()) % memory::kDefaultAlignment);
+
+    Matrix matrix(5, 5);
+    EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(matrix.Data()) % memory::kDefaultAlignment);
+}
+
+TEST(StorageTest, CopyMoveCase) {
+    for (std::size_t size : {3U, 40U}) {
+        Storage source(size, 3.0);
+        Storage copied(source);
+        copied[0] = 1.0;
+        EXPECT_EQ(3.0, source[0]);
+        EXPECT_EQ(size, copied.Size());
+
+        const double* heap_data = source.Data();
+        Storage moved(std::move(source));
+        EXPECT_EQ(size, moved.Size());
+        EXPECT_EQ(3.0, moved[size - 1]);
+        EXPECT_EQ(0U, source.Size());  // NOLINT(bugprone-use-after-move)
+        if (!moved.IsInline()) {
+            EXPECT_EQ(heap_data, moved.Data());
+        }
+
+        copied = moved;
+        EXPECT_EQ(3.0, copied[0]);
+        moved = Storage(1, 5.0);
+        EXPECT_EQ(5.0, moved[0]);
+        EXPECT_TRUE(moved.IsInline());
+    }
+}
+
+}  // namespace test
+}  // namespace math_cpp
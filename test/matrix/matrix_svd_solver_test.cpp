@@ -0,0 +1,123 @@
+/// @file matrix_svd_solver_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_svd_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <eigen3/Eigen/Dense>
+#include <limits>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+using matrix::SVDSolver;
+
+namespace {
+/// Compares with Eigen and checks A = U * diag(S) * V^T with orthonormal factors.
+void ExpectDecomposition(const Matrix& A) {
+    const std::size_t k = std::min(A.Row(), A.Col());
+    Eigen::JacobiSVD<Eigen::MatrixXd> expect(MakeEigenMatrix(A));
+    SVDSolver solver(A);
+
+    Matrix S = solver.SingularValues();
+    Eigen::MatrixXd expect_values = expect.singularValues();
+    EXPECT_TRUE(expect_values == S);
+
+    Matrix U = solver.U();
+    Matrix Vt = solver.VTranspose();
+    EXPECT_EQ(A.Row(), U.Row());
+    EXPECT_EQ(k, U.Col());
+    EXPECT_EQ(k, Vt.Row());
+    EXPECT_EQ(A.Col(), Vt.Col());
+    EXPECT_EQ(Matrix::Identity(k), U.Transpose() * U);
+    EXPECT_EQ(Matrix::Identity(k), Vt * Vt.Transpose());
+
+    Matrix D(k, k);
+    for (std::size_t i = 0; i < k; ++i) {
+        D(i, i) = S(i, 0);
+    }
+    Matrix restore_A = U * D * Vt;
+    EXPECT_EQ(A, restore_A);
+}
+}  // namespace
+
+TEST(SVDSolverTest, EigenLibCase) {
+    // Square over several panels, tall below and above the QR crossover, and wide.
+    ExpectDecomposition(Matrix::Random(100, 100));
+    ExpectDecomposition(Matrix::Random(90, 70));
+    ExpectDecomposition(Matrix::Random(300, 45));
+    ExpectDecomposition(Matrix::Random(37, 120));
+}
+
+TEST(SVDSolverTest, ValuesOnlyCase) {
+    Matrix A = Matrix::Random(80, 60);
+    Eigen::JacobiSVD<Eigen::MatrixXd> expect(MakeEigenMatrix(A));
+
+    SVDSolver solver(A, SVDSolver::Mode::kValuesOnly);
+
+    Eigen::MatrixXd expect_values = expect.singularValues();
+    EXPECT_TRUE(expect_values == solver.SingularValues());
+    EXPECT_THROW(solver.U(), std::invalid_argument);
+    EXPECT_THROW(solver.VTranspose(), std::invalid_argument);
+    EXPECT_THROW(solver.PseudoInverse(), std::invalid_argument);
+}
+
+TEST(SVDSolverTest, RankDeficientCase) {
+    // Rank 12 by construction.
+    Matrix A = Matrix::Random(50, 12) * Matrix::Random(12, 40);
+    SVDSolver solver(A);
+
+    EXPECT_EQ(12U, solver.Rank());
+    EXPECT_GT(solver.ConditionNumber(), 1e10);
+
+    Eigen::MatrixXd expect = MakeEigenMatrix(A).completeOrthogonalDecomposition().pseudoInverse();
+    Matrix pinv = solver.PseudoInverse();
+    EXPECT_EQ(40U, pinv.Row());
+    EXPECT_EQ(50U, pinv.Col());
+    EXPECT_TRUE(expect == pinv);
+
+    // Penrose conditions A * A^+ * A = A and A^+ * A * A^+ = A^+
+    EXPECT_EQ(A, A * pinv * A);
+    EXPECT_EQ(pinv, pinv * A * pinv);
+
+    // Everything counts as zero above the largest value.
+    EXPECT_EQ(0U, solver.Rank(solver.SingularValues()(0, 0)));
+    EXPECT_EQ(Matrix(40, 50), solver.PseudoInverse(solver.SingularValues()(0, 0)));
+}
+
+TEST(SVDSolverTest, ConditionNumberCase) {
+    Matrix A{{3.0, 0.0, 0.0}, {0.0, -4.0, 0.0}, {0.0, 0.0, 0.5}};
+    SVDSolver solver(A);
+
+    EXPECT_EQ(Matrix({{4.0}, {3.0}, {0.5}}), solver.SingularValues());
+    EXPECT_DOUBLE_EQ(8.0, solver.ConditionNumber());
+    EXPECT_EQ(3U, solver.Rank());
+    EXPECT_EQ(Matrix({{1.0 / 3.0, 0.0, 0.0}, {0.0, -0.25, 0.0}, {0.0, 0.0, 2.0}}), solver.PseudoInverse());
+
+    SVDSolver zero(Matrix(4, 3));
+    EXPECT_EQ(Matrix(3, 1), zero.SingularValues());
+    EXPECT_EQ(0U, zero.Rank());
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), zero.ConditionNumber());
+    EXPECT_EQ(Matrix(3, 4), zero.PseudoInverse());
+
+    SVDSolver single(Matrix({{-2.0}}));
+    EXPECT_EQ(Matrix({{2.0}}), single.SingularValues());
+    EXPECT_EQ(Matrix({{-2.0}}), single.U() * single.SingularValues() * single.VTranspose());
+}
+
+}  // namespace test
+}  // namespace math_cpp
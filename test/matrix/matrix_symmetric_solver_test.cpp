@@ -0,0 +1,99 @@
+/// @file matrix_symmetric_solver_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_symmetric_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::EigenSolver;
+using matrix::Matrix;
+using matrix::SymmetricEigenSolver;
+
+TEST(SymmetricEigenSolverTest, EigenLibCase) {
+    Matrix A = MakeSymmetric(150);
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> expect(MakeEigenMatrix(A));
+
+    SymmetricEigenSolver solver(A);
+
+    Eigen::MatrixXd expect_values = expect.eigenvalues();
+    EXPECT_TRUE(expect_values == solver.Eigenvalues());
+
+    // A = V * diag(values) * V^T and V^T * V = I
+    Matrix V = solver.Eigenvectors();
+    Matrix D(150, 150);
+    for (std::size_t i = 0; i < 150; ++i) {
+        D(i, i) = solver.Eigenvalues()(i, 0);
+    }
+    Matrix restore_A = V * D * V.Transpose();
+    EXPECT_EQ(A, restore_A);
+    Matrix VtV = V.Transpose() * V;
+    EXPECT_EQ(Matrix::Identity(150), VtV);
+}
+
+TEST(SymmetricEigenSolverTest, ValuesOnlyCase) {
+    Matrix A = MakeSymmetric(100);
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> expect(MakeEigenMatrix(A), Eigen::EigenvaluesOnly);
+
+    SymmetricEigenSolver solver(A, SymmetricEigenSolver::Mode::kValuesOnly);
+
+    Eigen::MatrixXd expect_values = expect.eigenvalues();
+    EXPECT_TRUE(expect_values == solver.Eigenvalues());
+    EXPECT_THROW(solver.Eigenvectors(), std::invalid_argument);
+}
+
+TEST(SymmetricEigenSolverTest, DegenerateCase) {
+    // Repeated eigenvalues and an already diagonal block
+    Matrix A{{2.0, 0.0, 0.0, 0.0}, {0.0, 2.0, 0.0, 0.0}, {0.0, 0.0, 1.0, 1.0}, {0.0, 0.0, 1.0, 1.0}};
+
+    SymmetricEigenSolver solver(A);
+
+    EXPECT_EQ(Matrix({{0.0}, {2.0}, {2.0}, {2.0}}), solver.Eigenvalues());
+    Matrix V = solver.Eigenvectors();
+    Matrix AV = A * V;
+    for (std::size_t i = 0; i < 4; ++i) {
+        Matrix scaled = V.GetCol(i) * solver.Eigenvalues()(i, 0);
+        EXPECT_EQ(scaled, AV.GetCol(i));
+    }
+
+    SymmetricEigenSolver single(Matrix({{-3.0}}));
+    EXPECT_EQ(Matrix({{-3.0}}), single.Eigenvalues());
+    EXPECT_EQ(Matrix({{1.0}}), single.Eigenvectors());
+}
+
+TEST(SymmetricEigenSolverTest, EigenSolverDispatchCase) {
+    Matrix A = MakeSymmetric(40);
+
+    Eigen::MatrixXd e_eigen_values{}, e_eigen_vectors{};
+    std::tie(e_eigen_values, e_eigen_vectors) = CalculateEigen(A);
+
+    EigenSolver solver(A);
+
+    EXPECT_TRUE(e_eigen_values == solver.Eigenvalues());
+    Matrix eigen_vectors = solver.Eigenvectors();
+    for (std::size_t col = 0; col < eigen_vectors.Col(); ++col) {
+        Matrix ev = eigen_vectors.GetCol(col);
+        Matrix e_ev = MakeMatrixFromEigen(e_eigen_vectors.col(col));
+
+        EXPECT_NEAR(1, std::abs(matrix::Util::CosineSimilarity(ev, e_ev)), 1e-4);
+    }
+}
+
+}  // namespace test
+}  // namespace math_cpp
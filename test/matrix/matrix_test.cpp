@@ -12,9 +12,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <eigen3/Eigen/Dense>
 #include <iostream>
 #include <stdexcept>
+#include <tuple>
 
 #include "test/matrix/matrix_test_helper.h"
 
@@ -143,6 +145,41 @@ TEST(MatrixTest, Determinant3x3Case) {
     EXPECT_EQ(6.0, det);
 }
 
+TEST(MatrixTest, Determinant1x1Case) {
+    Matrix A{{-4.0}};
+
+    EXPECT_EQ(-4.0, Matrix::Determinant(A));
+}
+
+TEST(MatrixTest, DeterminantLargeCase) {
+    Matrix A = Matrix::Random(12, 12);
+    Eigen::MatrixXd eA = MakeEigenMatrix(A);
+
+    double det = Matrix::Determinant(A);
+
+    EXPECT_NEAR(eA.determinant(), det, 1e-9 * std::abs(eA.determinant()));
+}
+
+TEST(MatrixTest, LogDeterminantCase) {
+    // det = 10^400 overflows a double, its log does not.
+    Matrix A = Matrix::Identity(200) * 100.0;
+    A(0, 0) = -100.0;
+
+    double sign = 0.0, log_abs = 0.0;
+    std::tie(sign, log_abs) = Matrix::LogDeterminant(A);
+
+    EXPECT_EQ(-1.0, sign);
+    EXPECT_NEAR(200.0 * std::log(100.0), log_abs, 1e-9);
+
+    Matrix B = Matrix::Random(30, 30);
+    std::tie(sign, log_abs) = Matrix::LogDeterminant(B);
+    EXPECT_NEAR(Matrix::Determinant(B), sign * std::exp(log_abs), 1e-9 * std::exp(log_abs));
+
+    std::tie(sign, log_abs) = Matrix::LogDeterminant(Matrix(4, 4));
+    EXPECT_EQ(0.0, sign);
+    EXPECT_TRUE(std::isinf(log_abs));
+}
+
 TEST(MatrixTest, EraseRowColMatrixCase11) {
     Matrix A{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}};
 
@@ -179,5 +216,48 @@ TEST(MatrixTest, EraseRowColMatrixCase12) {
     EXPECT_EQ(Matrix({{1.0, 2.0}, {7.0, 8.0}}), result);
 }
 
+TEST(MatrixTest, TransposeCase) {
+    Matrix A = Matrix::Random(45, 70);
+    Eigen::MatrixXd expect = MakeEigenMatrix(A).transpose();
+    EXPECT_TRUE(expect == A.Transpose());
+
+    Matrix B = A.Transpose();
+    B.TransposeInPlace();
+    EXPECT_EQ(A, B);
+
+    Matrix S = Matrix::Random(45, 45);
+    Eigen::MatrixXd expect_square = MakeEigenMatrix(S).transpose();
+    const double* data = S.Data();
+    S.TransposeInPlace();
+    EXPECT_TRUE(expect_square == S);
+    EXPECT_EQ(data, S.Data());
+}
+
+TEST(MatrixTest, SetRowCase) {
+    Matrix A{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    A.SetRow(1, Matrix({{7.0}, {8.0}}));
+    EXPECT_EQ(Matrix({{1.0, 7.0, 3.0}, {4.0, 8.0, 6.0}}), A);
+
+    EXPECT_THROW(A.SetRow(3, Matrix({{7.0}, {8.0}})), std::invalid_argument);
+    EXPECT_THROW(A.SetRow(0, Matrix({{7.0, 8.0}})), std::invalid_argument);
+}
+
+TEST(MatrixTest, BoundsCheckCase) {
+    Matrix A{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    EXPECT_EQ(6.0, A.AtUnchecked(1, 2));
+    EXPECT_EQ(A(1, 2), A.AtUnchecked(1, 2));
+
+#ifdef MATH_CPP_BOUNDS_CHECK
+    // The last valid index passes, one past it throws.
+    EXPECT_NO_THROW(A(1, 2));
+    EXPECT_THROW(A(2, 0), std::invalid_argument);
+    EXPECT_THROW(A(0, 3), std::invalid_argument);
+    EXPECT_THROW(A.View()(2, 0), std::invalid_argument);
+    EXPECT_THROW(A.RowView(0)(0, 3), std::invalid_argument);
+#else
+    GTEST_SKIP() << "built without MATH_CPP_BOUNDS_CHECK";
+#endif
+}
+
 }  // namespace test
 }  // namespace math_cpp
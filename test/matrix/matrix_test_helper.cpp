@@ -30,7 +30,7 @@ Eigen::MatrixXd MakeEigenMatrix(const Matrix& mat) {
     Eigen::MatrixXd result(mat.Row(), mat.Col());
     for (std::size_t r = 0; r < mat.Row(); ++r) {
         for (std::size_t c = 0; c < mat.Col(); ++c) {
-            result(r, c) = mat(r, c);
+            result(r, c) = mat.AtUnchecked(r, c);
         }
     }
     return result;
@@ -69,7 +69,7 @@ matrix::Matrix MakeMatrixFromEigen(const Eigen::MatrixXd& mat) {
 
     for (size_t r = 0; r < result.Row(); ++r) {
         for (size_t c = 0; c < result.Col(); ++c) {
-            result(r, c) = mat(r, c);
+            result.AtUnchecked(r, c) = mat(r, c);
         }
     }
 
@@ -81,6 +81,17 @@ Eigen::MatrixXd MakeRandomEigenMatrix(std::size_t row, std::size_t col) {
     return result;
 }
 
+Matrix MakeSymmetric(std::size_t size) {
+    Matrix A = Matrix::Random(size, size);
+    Matrix S = A + A.Transpose();
+    return S;
+}
+
+Matrix MakeSymmetricPositiveDefinite(std::size_t size) {
+    Matrix B = Matrix::Random(size, size);
+    return B.Transpose() * B + Matrix::Identity(size) * static_cast<double>(size);
+}
+
 bool operator==(const Matrix& lhs, const Eigen::MatrixXd& rhs) {
     if (lhs.Row() != rhs.rows()) return false;
     if (lhs.Col() != rhs.cols()) return false;
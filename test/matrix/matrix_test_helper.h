@@ -27,6 +27,10 @@ Eigen::MatrixXd MakeEigenMatrix(const matrix::Matrix& mat);
 matrix::Matrix MakeMatrixFromEigen(const Eigen::MatrixXd& mat);
 std::pair<Eigen::MatrixXd, Eigen::MatrixXd> CalculateEigen(const matrix::Matrix& mat);
 Eigen::MatrixXd MakeRandomEigenMatrix(std::size_t row, std::size_t col);
+/// @brief Random size x size matrix A + A^T.
+matrix::Matrix MakeSymmetric(std::size_t size);
+/// @brief Random size x size matrix B^T * B + size * I.
+matrix::Matrix MakeSymmetricPositiveDefinite(std::size_t size);
 
 bool operator==(const matrix::Matrix& lhs, const Eigen::MatrixXd& rhs);
 bool operator==(const Eigen::MatrixXd& lhs, const matrix::Matrix& rhs);
@@ -0,0 +1,106 @@
+/// @file matrix_view_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/matrix/matrix_view.h"
+
+#include <gtest/gtest.h>
+
+#include <eigen3/Eigen/Dense>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::ConstMatrixView;
+using matrix::Matrix;
+using matrix::MatrixView;
+
+TEST(MatrixViewTest, RowColBlockCase) {
+    Matrix A{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}};
+
+    EXPECT_EQ(Matrix({{4.0, 5.0, 6.0}}), A.RowView(1).ToMatrix());
+    EXPECT_EQ(Matrix({{2.0}, {5.0}, {8.0}}), A.ColView(1).ToMatrix());
+    EXPECT_EQ(Matrix({{5.0, 6.0}, {8.0, 9.0}}), A.Block(1, 1, 2, 2).ToMatrix());
+    EXPECT_EQ(A.Transpose(), A.View().Transpose().ToMatrix());
+    EXPECT_EQ(Matrix({{2.0, 5.0}}), A.Block(0, 1, 2, 2).ColView(0).Transpose().ToMatrix());
+
+    EXPECT_THROW(A.RowView(3), std::invalid_argument);
+    EXPECT_THROW(A.ColView(3), std::invalid_argument);
+    EXPECT_THROW(A.Block(2, 2, 2, 1), std::invalid_argument);
+}
+
+TEST(MatrixViewTest, WriteThroughCase) {
+    Matrix A(3, 3);
+
+    MatrixView block = A.Block(1, 0, 2, 2);
+    block(1, 1) = 2.0;
+    A.ColView(2)(0, 0) = 3.0;
+    // Row 1 of A written through a column of the transposed view
+    matrix::kernel::Copy(Matrix({{1.0}, {1.0}, {1.0}}), A.View().Transpose().ColView(1));
+
+    EXPECT_EQ(Matrix({{0.0, 0.0, 3.0}, {1.0, 1.0, 1.0}, {0.0, 2.0, 0.0}}), A);
+
+    const Matrix& const_A = A;
+    ConstMatrixView read_only = const_A.RowView(2);
+    EXPECT_EQ(2.0, read_only(0, 1));
+}
+
+TEST(MatrixViewTest, KernelCase) {
+    Matrix A = Matrix::Random(20, 30);
+    Matrix B = Matrix::Random(20, 10);
+    Eigen::MatrixXd eA = MakeEigenMatrix(A), eB = MakeEigenMatrix(B);
+
+    // A^T * B through a transposed view
+    Matrix C(30, 10);
+    matrix::kernel::Gemm(1.0, A.View().Transpose(), B, 0.0, C);
+    Eigen::MatrixXd expect = eA.transpose() * eB;
+    EXPECT_TRUE(expect == C);
+
+    // Product written into a block of a larger matrix
+    Matrix D(40, 40, 1.0);
+    matrix::kernel::Gemm(2.0, A.Block(0, 0, 10, 30), A.Block(10, 0, 10, 30).Transpose(), 1.0, D.Block(5, 7, 10, 10));
+    Eigen::MatrixXd eD = Eigen::MatrixXd::Ones(40, 40);
+    eD.block(5, 7, 10, 10) += 2.0 * eA.block(0, 0, 10, 30) * eA.block(10, 0, 10, 30).transpose();
+    EXPECT_TRUE(eD == D);
+
+    // Column kernels on strided views
+    matrix::kernel::Axpy(0.5, A.ColView(3), B.ColView(4));
+    eB.col(4) += 0.5 * eA.col(3);
+    EXPECT_TRUE(eB == B);
+
+    EXPECT_NEAR(eA.col(1).dot(eA.col(2)), matrix::kernel::Dot(A.ColView(1), A.ColView(2)), 1e-9);
+    EXPECT_NEAR(eA.block(2, 3, 5, 6).norm(), matrix::kernel::Norm2(A.Block(2, 3, 5, 6)), 1e-9);
+
+    matrix::kernel::Scale(-1.0, A.Block(0, 0, 20, 2));
+    eA.block(0, 0, 20, 2) *= -1.0;
+    EXPECT_TRUE(eA == A);
+
+    EXPECT_THROW(matrix::kernel::Gemm(1.0, A, B, 0.0, C), std::invalid_argument);
+    EXPECT_THROW(matrix::kernel::Dot(A.ColView(0), A.RowView(0)), std::invalid_argument);
+}
+
+TEST(MatrixViewTest, CopyingAccessorsCase) {
+    Matrix A{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}};
+
+    EXPECT_EQ(Matrix({{1.0, 3.0}, {7.0, 9.0}}), Matrix::EraseRowCol(A, 1, 1));
+    EXPECT_EQ(Matrix({{5.0, 6.0}, {8.0, 9.0}}), Matrix::EraseRowCol(A, 0, 0));
+    EXPECT_EQ(Matrix({{1.0, 2.0}, {4.0, 5.0}}), Matrix::EraseRowCol(A, 2, 2));
+    EXPECT_EQ(Matrix({{5.0, 6.0}, {8.0, 9.0}}), A.GetSubMatrix(1, 1));
+
+    Matrix B(4, 4);
+    B.Copy(1, 2, Matrix({{1.0, 2.0}, {3.0, 4.0}}));
+    EXPECT_EQ(Matrix({{0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 1.0, 2.0}, {0.0, 0.0, 3.0, 4.0}, {0.0, 0.0, 0.0, 0.0}}), B);
+}
+
+}  // namespace test
+}  // namespace math_cpp
@@ -0,0 +1,95 @@
+/// @file allocator_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/memory/allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "src/matrix/matrix.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+
+namespace {
+bool IsAligned(const void* ptr, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+}  // namespace
+
+TEST(AllocatorTest, HeapAlignmentCase) {
+    memory::HeapAllocator& heap = memory::HeapAllocator::GetInstance();
+    for (std::size_t alignment : {8U, 16U, 64U, 256U}) {
+        void* ptr = heap.Allocate(24, alignment);
+        EXPECT_TRUE(IsAligned(ptr, alignment));
+        heap.Deallocate(ptr, 24, alignment);
+    }
+}
+
+TEST(AllocatorTest, ArenaCase) {
+    memory::ArenaAllocator arena(1024);
+
+    void* first = arena.Allocate(10, 64);
+    void* second = arena.Allocate(10, 64);
+    EXPECT_TRUE(IsAligned(first, 64));
+    EXPECT_TRUE(IsAligned(second, 64));
+    EXPECT_NE(first, second);
+    EXPECT_EQ(20U, arena.BytesUsed());
+
+    // Larger than a chunk
+    void* large = arena.Allocate(4096, 64);
+    EXPECT_TRUE(IsAligned(large, 64));
+    EXPECT_GE(arena.Capacity(), 4096U + 1024U);
+
+    arena.Reset();
+    EXPECT_EQ(0U, arena.BytesUsed());
+    EXPECT_EQ(first, arena.Allocate(10, 64));
+}
+
+TEST(AllocatorTest, ScopeCase) {
+    memory::ArenaAllocator outer{};
+    memory::ArenaAllocator inner{};
+
+    EXPECT_EQ(&memory::HeapAllocator::GetInstance(), &memory::AllocatorScope::Current());
+    {
+        memory::AllocatorScope outer_scope(outer);
+        EXPECT_EQ(&outer, &memory::AllocatorScope::Current());
+        {
+            memory::AllocatorScope inner_scope(inner);
+            EXPECT_EQ(&inner, &memory::AllocatorScope::Current());
+        }
+        EXPECT_EQ(&outer, &memory::AllocatorScope::Current());
+    }
+    EXPECT_EQ(&memory::HeapAllocator::GetInstance(), &memory::AllocatorScope::Current());
+}
+
+TEST(AllocatorTest, MatrixInArenaCase) {
+    Matrix A = Matrix::Random(20, 20);
+    Matrix expect = A * A;
+
+    memory::ArenaAllocator arena{};
+    Matrix result{};
+    {
+        memory::AllocatorScope scope(arena);
+        result = A * A;
+        EXPECT_GE(arena.BytesUsed(), 20U * 20U * sizeof(double));
+    }
+    Matrix copied = result;
+    arena.Reset();
+
+    EXPECT_EQ(expect, copied);
+    EXPECT_TRUE(IsAligned(copied.Data(), memory::kDefaultAlignment));
+}
+
+}  // namespace test
+}  // namespace math_cpp
@@ -0,0 +1,40 @@
+/// @file memory_test_helper.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "test/memory/memory_test_helper.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<std::size_t> global_allocations{0};
+}  // namespace
+
+void* operator new(std::size_t bytes) {
+    global_allocations.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc((bytes == 0) ? 1 : bytes);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t /*bytes*/) noexcept { std::free(ptr); }
+
+namespace math_cpp {
+namespace test {
+
+std::size_t GlobalAllocations() { return global_allocations.load(std::memory_order_relaxed); }
+
+}  // namespace test
+}  // namespace math_cpp
@@ -0,0 +1,26 @@
+/// @file memory_test_helper.h
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#ifndef TEST_MEMORY_MEMORY_TEST_HELPER_H_
+#define TEST_MEMORY_MEMORY_TEST_HELPER_H_
+
+#include <cstddef>
+
+namespace math_cpp {
+namespace test {
+
+/// @brief Calls of the global operator new so far, from any thread. The test binary replaces operator new to count
+/// them, so this sees every heap allocation, not only those that go through memory::Allocator.
+std::size_t GlobalAllocations();
+
+}  // namespace test
+}  // namespace math_cpp
+
+#endif  // TEST_MEMORY_MEMORY_TEST_HELPER_H_
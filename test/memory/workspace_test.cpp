@@ -0,0 +1,104 @@
+/// @file workspace_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/memory/workspace.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+#include "src/matrix/matrix.h"
+#include "test/memory/memory_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+
+TEST(WorkspaceTest, FrameCase) {
+    memory::Workspace workspace(256);
+    EXPECT_EQ(256U, workspace.Capacity());
+    {
+        memory::Workspace::Frame outer(workspace);
+        EXPECT_EQ(&workspace, &memory::AllocatorScope::Current());
+        workspace.Allocate(100, 8);
+        {
+            memory::Workspace::Frame inner(workspace);
+            workspace.Allocate(100, 8);
+            // Does not fit, goes to the heap
+            workspace.Allocate(100, 8);
+            EXPECT_GT(workspace.BytesUsed(), 256U);
+            EXPECT_THROW(workspace.Reserve(1024), std::logic_error);
+        }
+        EXPECT_EQ(100U, workspace.BytesUsed());
+    }
+    EXPECT_EQ(0U, workspace.BytesUsed());
+    EXPECT_EQ(&memory::HeapAllocator::GetInstance(), &memory::AllocatorScope::Current());
+
+    // The buffer was regrown to the high-water mark, the same work now fits.
+    EXPECT_EQ(workspace.HighWaterMark(), workspace.Capacity());
+    const std::size_t heap_allocations = workspace.HeapAllocations();
+    {
+        memory::Workspace::Frame frame(workspace);
+        workspace.Allocate(100, 8);
+        workspace.Allocate(100, 8);
+        workspace.Allocate(100, 8);
+    }
+    EXPECT_EQ(heap_allocations, workspace.HeapAllocations());
+}
+
+TEST(WorkspaceTest, SteadyStateCase) {
+    // Past the small sizes, so the blocked LU and the packed GEMM are used as well.
+    for (std::size_t n : {40, 200}) {
+        memory::Workspace workspace{};
+        Matrix inverse{};
+        matrix::EigenSolver eigen_solver{};
+        Matrix A = Matrix::Random(n, n);
+        Matrix S = A + A.Transpose();
+        const Matrix expect_inverse = A.Inverse();
+        const double expect_determinant = Matrix::Determinant(A);
+        const Matrix expect_values = matrix::EigenSolver(S).Eigenvalues();
+
+        for (int i = 0; i < 4; ++i) {
+            // Every heap allocation of the process is counted, not only those of the workspace.
+            const std::size_t before = GlobalAllocations();
+            A.Inverse(workspace, inverse);
+            const double determinant = Matrix::Determinant(A, workspace);
+            eigen_solver.Compute(S, workspace);
+            const std::size_t allocations = GlobalAllocations() - before;
+
+            // Two rounds of warm-up, every pool thread may touch its thread-local GEMM buffer for the first time.
+            if (i >= 2) {
+                EXPECT_EQ(0U, allocations) << "n = " << n;
+            }
+            EXPECT_EQ(expect_inverse, inverse);
+            EXPECT_NEAR(expect_determinant, determinant, 1e-9 * std::abs(expect_determinant));
+            EXPECT_EQ(expect_values, eigen_solver.Eigenvalues());
+        }
+    }
+
+    // Sized in advance from the high-water mark of a first run, a new workspace never grows.
+    memory::Workspace workspace{};
+    Matrix inverse{};
+    matrix::EigenSolver eigen_solver{};
+    Matrix A = Matrix::Random(40, 40);
+    Matrix S = A + A.Transpose();
+    A.Inverse(workspace, inverse);
+    eigen_solver.Compute(S, workspace);
+
+    memory::Workspace sized(workspace.HighWaterMark());
+    A.Inverse(sized, inverse);
+    eigen_solver.Compute(S, sized);
+    EXPECT_EQ(1U, sized.HeapAllocations());
+}
+
+}  // namespace test
+}  // namespace math_cpp
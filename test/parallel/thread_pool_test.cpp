@@ -0,0 +1,146 @@
+/// @file thread_pool_test.cpp
+/// @author sangwon (leeh8911@gmail.com)
+/// @brief
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2022
+///
+///
+
+#include "src/parallel/thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "src/matrix/matrix.h"
+#include "test/matrix/matrix_test_helper.h"
+#include "test/memory/memory_test_helper.h"
+
+namespace math_cpp {
+namespace test {
+
+using matrix::Matrix;
+using parallel::ThreadPool;
+
+class ThreadPoolTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        ThreadPool& pool = ThreadPool::GetInstance();
+        worker_count_ = pool.WorkerCount();
+        serial_threshold_ = pool.SerialThreshold();
+        pool.SetWorkerCount(4);
+        pool.SetSerialThreshold(0);
+    }
+    void TearDown() override {
+        ThreadPool& pool = ThreadPool::GetInstance();
+        pool.SetWorkerCount(worker_count_);
+        pool.SetSerialThreshold(serial_threshold_);
+    }
+
+ private:
+    std::size_t worker_count_{};
+    std::size_t serial_threshold_{};
+};
+
+TEST_F(ThreadPoolTest, VisitEveryIndexOnceCase) {
+    std::vector<std::atomic<int>> visits(1000);
+    for (auto& visit : visits) visit.store(0);
+
+    parallel::ParallelFor(0, visits.size(), 1, [&visits](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            visits[i].fetch_add(1);
+        }
+    });
+
+    for (auto& visit : visits) {
+        EXPECT_EQ(1, visit.load());
+    }
+}
+
+TEST_F(ThreadPoolTest, SerialThresholdCase) {
+    ThreadPool::GetInstance().SetSerialThreshold(1000);
+    const std::thread::id caller = std::this_thread::get_id();
+    std::size_t calls = 0;
+
+    parallel::ParallelFor(0, 99, 10, [&](std::size_t first, std::size_t last) {
+        EXPECT_EQ(caller, std::this_thread::get_id());
+        EXPECT_EQ(0, first);
+        EXPECT_EQ(99, last);
+        ++calls;
+    });
+
+    EXPECT_EQ(1, calls);
+}
+
+TEST_F(ThreadPoolTest, NestedLoopCase) {
+    std::atomic<std::size_t> sum{0};
+
+    parallel::ParallelFor(0, 16, 1, [&sum](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            parallel::ParallelFor(0, 100, 1, [&sum](std::size_t inner_first, std::size_t inner_last) {
+                sum.fetch_add(inner_last - inner_first);
+            });
+        }
+    });
+
+    EXPECT_EQ(1600, sum.load());
+}
+
+TEST_F(ThreadPoolTest, ExceptionCase) {
+    EXPECT_THROW(parallel::ParallelFor(0, 100, 1,
+                                       [](std::size_t first, std::size_t) {
+                                           if (first == 0) {
+                                               throw std::invalid_argument("failed");
+                                           }
+                                       }),
+                 std::invalid_argument);
+}
+
+TEST_F(ThreadPoolTest, SerialLoopAllocationCase) {
+    // A capture larger than the small buffer of std::function, a serial loop must still not allocate.
+    ThreadPool::GetInstance().SetSerialThreshold(1000);
+    double values[8] = {};
+    double a = 1.0;
+    double b = 2.0;
+    double c = 3.0;
+    double d = 4.0;
+    const std::size_t before = GlobalAllocations();
+
+    parallel::ParallelFor(0, 8, 10, [&values, &a, &b, &c, &d](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            values[i] = a + b + c + d;
+        }
+    });
+
+    EXPECT_EQ(before, GlobalAllocations());
+    EXPECT_EQ(10.0, values[7]);
+}
+
+TEST_F(ThreadPoolTest, WorkerCountCase) {
+    ThreadPool::GetInstance().SetWorkerCount(3);
+
+    EXPECT_EQ(3, ThreadPool::GetInstance().WorkerCount());
+}
+
+TEST_F(ThreadPoolTest, ParallelMatrixKernelCase) {
+    Matrix a = Matrix::Random(300, 200);
+    Matrix b = Matrix::Random(200, 260);
+    Matrix square = Matrix::Random(60, 60) + 60.0 * Matrix::Identity(60);
+
+    Eigen::MatrixXd expect_product = MakeEigenMatrix(a) * MakeEigenMatrix(b);
+    Eigen::MatrixXd expect_transpose = MakeEigenMatrix(a).transpose();
+    Eigen::MatrixXd expect_inverse = MakeEigenMatrix(square).inverse();
+
+    EXPECT_TRUE(expect_product == a * b);
+    EXPECT_TRUE(expect_transpose == a.Transpose());
+    EXPECT_TRUE(expect_inverse == square.Inverse());
+    EXPECT_NEAR(MakeEigenMatrix(a).norm(), Matrix::Norm2(a), 1e-9);
+}
+
+}  // namespace test
+}  // namespace math_cpp
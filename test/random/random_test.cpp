@@ -13,8 +13,16 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <set>
+#include <thread>
 #include <vector>
 
+#include "src/matrix/matrix.h"
+#include "src/matrix/matrix_simd.h"
+
 namespace math_cpp {
 
 namespace test {
@@ -52,7 +60,7 @@ std::ostream& operator<<(std::ostream& os, const std::vector<double>& src) {
 }
 
 TEST(RandomTest, UniformCase) {
-    Random generator = Random::GetInstance();
+    Random& generator = Random::GetInstance();
 
     std::size_t max_iter = 100;
     std::vector<double> values{};
@@ -70,11 +78,10 @@ TEST(RandomTest, UniformCase) {
 }
 
 TEST(RandomTest, GaussianCase) {
-    GTEST_SKIP();
-
-    Random generator = Random::GetInstance();
+    Random::SetSeed(2022);
+    Random& generator = Random::GetInstance();
 
-    std::size_t max_iter = 100;
+    std::size_t max_iter = 10000;
 
     double actual_mean = 0.0;
     double actual_std = 1.0;
@@ -92,6 +99,155 @@ TEST(RandomTest, GaussianCase) {
     EXPECT_NEAR(actual_mean, mean, 1e-1);
     EXPECT_NEAR(actual_std, std_dev, 1e-1);
 }
+
+TEST(RandomTest, SeedCase) {
+    Random first(42);
+    Random second(42);
+    Random other_stream(42, 1);
+    std::set<double> values{};
+    for (int i = 0; i < 100; ++i) {
+        const double value = first.Uniform();
+        EXPECT_EQ(value, second.Uniform());
+        EXPECT_NE(value, other_stream.Uniform());
+        values.insert(value);
+    }
+    EXPECT_EQ(100U, values.size());
+
+    // Stream 2 is stream 0 jumped twice.
+    Xoshiro256 engine(7);
+    engine.Jump();
+    engine.Jump();
+    Random stream(7, 2);
+    EXPECT_EQ(engine(), stream.Engine()());
+
+    // The engine plugs into the standard distributions.
+    std::uniform_int_distribution<int> dice(1, 6);
+    const int roll = dice(first.Engine());
+    EXPECT_LE(1, roll);
+    EXPECT_GE(6, roll);
+}
+
+TEST(RandomTest, KnownAnswerCase) {
+    // Reference xoshiro256** outputs, its state seeded by four SplitMix64 draws as in the authors' C code.
+    Xoshiro256 engine(0);
+    EXPECT_EQ(0x99ec5f36cb75f2b4ULL, engine());
+    EXPECT_EQ(0xbf6e1f784956452aULL, engine());
+    EXPECT_EQ(0x1a5f849d4933e6e0ULL, engine());
+    EXPECT_EQ(0x6aa594f1262d2d2cULL, engine());
+
+    Random stream0(12345);
+    EXPECT_EQ(0xbe6a36374160d49bULL, stream0.Engine()());
+    EXPECT_EQ(0x214aaa0637a688c6ULL, stream0.Engine()());
+    // Stream 2 starts after two jumps with the reference jump polynomial.
+    Random stream2(12345, 2);
+    EXPECT_EQ(0x36ed391af643c481ULL, stream2.Engine()());
+    EXPECT_EQ(0x1f6891d6e8f17eb7ULL, stream2.Engine()());
+
+    // Uniform keeps the top 53 bits of the first output.
+    Random uniform(12345);
+    EXPECT_EQ(std::ldexp(static_cast<double>(0xbe6a36374160d49bULL >> 11), -53), uniform.Uniform());
+}
+
+TEST(RandomTest, ThreadCase) {
+    Random::SetSeed(7);
+    const double value = Random::GetInstance().Uniform();
+    Random::SetSeed(7);
+    EXPECT_EQ(value, Random::GetInstance().Uniform());
+
+    // Every thread has its own generator on its own stream.
+    Random* main_generator = &Random::GetInstance();
+    Random* thread_generator = nullptr;
+    double thread_value = 0.0;
+    std::thread worker([&thread_generator, &thread_value] {
+        thread_generator = &Random::GetInstance();
+        thread_value = thread_generator->Uniform();
+    });
+    worker.join();
+    EXPECT_NE(main_generator, thread_generator);
+    EXPECT_NE(Random(7, 1).Uniform(), Random(7, 0).Uniform());
+    EXPECT_EQ(Random(7, 1).Uniform(), thread_value);
+}
+
+TEST(RandomTest, MatrixCase) {
+    // Consecutive matrices continue the sequence instead of repeating it.
+    matrix::Matrix first = matrix::Matrix::Random(4, 4);
+    matrix::Matrix second = matrix::Matrix::Random(4, 4);
+    EXPECT_NE(first(0, 0), second(0, 0));
+
+    Random lhs(3, 5);
+    Random rhs(3, 5);
+    EXPECT_EQ(matrix::Matrix::Random(8, 8, lhs).Data()[63], matrix::Matrix::Random(8, 8, rhs).Data()[63]);
+}
+
+TEST(RandomTest, FillUniformCase) {
+    // Two and a half blocks, and a size that is not a multiple of the lane count.
+    const std::size_t size = 163843;
+    std::vector<double> values(size);
+    std::vector<double> repeat(size);
+    Random lhs(11);
+    Random rhs(11);
+    FillUniform(lhs, values.data(), size, -2.0, 3.0);
+    FillUniform(rhs, repeat.data(), size, -2.0, 3.0);
+    EXPECT_EQ(values, repeat);
+
+    EXPECT_LE(-2.0, *std::min_element(std::begin(values), std::end(values)));
+    EXPECT_GT(3.0, *std::max_element(std::begin(values), std::end(values)));
+    EXPECT_NEAR(0.5, Mean(values), 1e-2);
+    EXPECT_NEAR(25.0 / 12.0, Variance(values), 2e-2);
+
+    // The fill advances the generator, the next fill gives new numbers.
+    FillUniform(lhs, repeat.data(), size, -2.0, 3.0);
+    EXPECT_NE(values, repeat);
+}
+
+TEST(RandomTest, FillGaussianCase) {
+    const std::size_t size = 1000003;
+    std::vector<double> values(size);
+    std::vector<double> repeat(size);
+    Random lhs(2022);
+    Random rhs(2022);
+    FillGaussian(lhs, values.data(), size, 1.0, 2.0);
+    FillGaussian(rhs, repeat.data(), size, 1.0, 2.0);
+    EXPECT_EQ(values, repeat);
+
+    EXPECT_NEAR(1.0, Mean(values), 1e-2);
+    EXPECT_NEAR(2.0, StandardDeviation(values), 1e-2);
+
+    // Probabilities of |z| below 1 and 2 and above 3, the last one is covered by the tail of the ziggurat.
+    std::size_t within_one = 0;
+    std::size_t within_two = 0;
+    std::size_t beyond_three = 0;
+    for (double value : values) {
+        const double z = std::abs(value - 1.0) / 2.0;
+        within_one += (z < 1.0) ? 1 : 0;
+        within_two += (z < 2.0) ? 1 : 0;
+        beyond_three += (z > 3.0) ? 1 : 0;
+    }
+    const double total = static_cast<double>(size);
+    EXPECT_NEAR(0.682689, static_cast<double>(within_one) / total, 2e-3);
+    EXPECT_NEAR(0.954500, static_cast<double>(within_two) / total, 1e-3);
+    EXPECT_NEAR(0.002700, static_cast<double>(beyond_three) / total, 3e-4);
+}
+
+TEST(RandomTest, FillIsaCase) {
+    // Every instruction set steps the engines to the same numbers.
+    const matrix::simd::Isa active = matrix::simd::ActiveIsa();
+    std::vector<double> expect(70001);
+    Random reference(5);
+    ASSERT_TRUE(matrix::simd::SetIsa(matrix::simd::Isa::kScalar));
+    FillGaussian(reference, expect.data(), expect.size());
+
+    for (auto isa : {matrix::simd::Isa::kSSE2, matrix::simd::Isa::kAVX2, matrix::simd::Isa::kAVX512}) {
+        if (!matrix::simd::SetIsa(isa)) {
+            continue;
+        }
+        std::vector<double> actual(expect.size());
+        Random generator(5);
+        FillGaussian(generator, actual.data(), actual.size());
+        EXPECT_EQ(expect, actual) << matrix::simd::IsaName(isa);
+    }
+    matrix::simd::SetIsa(active);
+}
 }  // namespace test
 
 }  // namespace math_cpp